@@ -2,6 +2,7 @@
 #include <string.h>
 #include <inttypes.h>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include <binaryninjaapi.h>
@@ -282,6 +283,33 @@ class PowerpcArchitecture: public Architecture
 	private:
 	BNEndianness endian;
 
+	/* lifting options (PPC_IL_*), read from settings on first use */
+	uint32_t liftOptions;
+	std::once_flag liftOptionsOnce;
+
+	uint32_t GetLiftOptions()
+	{
+		std::call_once(liftOptionsOnce, [this]() {
+			Ref<Settings> settings = Settings::Instance();
+
+			liftOptions = PPC_IL_OPTIONS_DEFAULT;
+			if (settings->Get<bool>("ppc.lift.crFields"))
+				liftOptions |= PPC_IL_CR_FIELDS;
+			if (settings->Get<bool>("ppc.lift.gprHelpers"))
+				liftOptions |= PPC_IL_GPR_HELPERS;
+			if (settings->Get<bool>("ppc.lift.compactMultiple"))
+				liftOptions |= PPC_IL_COMPACT_MULTIPLE;
+			if (settings->Get<bool>("ppc.lift.countedLoops"))
+				liftOptions |= PPC_IL_COUNTED_LOOPS;
+		});
+
+		return liftOptions;
+	}
+
+	/* memo shared by all Assemble() calls on this architecture, so a patch
+		being edited only reassembles the lines that changed */
+	assemble_session *asmSession;
+
 	/* this can maybe be moved to the API later */
 	BNRegisterInfo RegisterInfo(uint32_t fullWidthReg, size_t offset, size_t size, bool zeroExtend = false)
 	{
@@ -299,6 +327,13 @@ class PowerpcArchitecture: public Architecture
 	PowerpcArchitecture(const char* name, BNEndianness endian_): Architecture(name)
 	{
 		endian = endian_;
+		liftOptions = PPC_IL_OPTIONS_DEFAULT;
+		asmSession = assemble_session_create();
+	}
+
+	virtual ~PowerpcArchitecture()
+	{
+		assemble_session_destroy(asmSession);
 	}
 
 	/*************************************************************************/
@@ -384,7 +419,19 @@ class PowerpcArchitecture: public Architecture
 				if (!(raw_insn & 2))
 					target += (uint32_t) addr;
 
-				if (raw_insn & 1)
+				/* GPR helpers, as LiftGprHelperCall() lifts them: the register
+					saves/restores in place, then a return for b and _restgpr_N_x */
+				uint32_t firstReg;
+				int helper = GPR_HELPER_NONE;
+				if (GetLiftOptions() & PPC_IL_GPR_HELPERS)
+					helper = GetGprHelper(target, &firstReg);
+
+				if (helper != GPR_HELPER_NONE)
+				{
+					if (!(raw_insn & 1) || helper == GPR_HELPER_REST_X)
+						result.AddBranch(FunctionReturn);
+				}
+				else if (raw_insn & 1)
 					result.AddBranch(CallDestination, target);
 				else
 					result.AddBranch(UnconditionalBranch, target);
@@ -756,7 +803,8 @@ class PowerpcArchitecture: public Architecture
 			goto cleanup;
 		}
 
-		rc = GetLowLevelILForPPCInstruction(this, il, data, addr, &res, endian == LittleEndian);
+		rc = GetLowLevelILForPPCInstruction(this, il, data, addr, &res, endian == LittleEndian,
+			GetLiftOptions());
 		len = 4;
 
 		cleanup:
@@ -771,6 +819,10 @@ class PowerpcArchitecture: public Architecture
 		bool signedWrite = true;
 		ExprId left, right;
 
+		/* mtcrf with any field mask: every flag written is the same as for mtcrN */
+		if (IL_FLAGWRITE_IS_MTCRF(flagWriteType))
+			return il.TestBit(4, il.GetExprForRegisterOrConstant(operands[0], 4), il.Const(4, 31u - flag));
+
 		switch (flagWriteType)
 		{
 			case IL_FLAGWRITE_CR0_U:
@@ -1010,7 +1062,7 @@ class PowerpcArchitecture: public Architecture
 	*/
 	virtual vector<uint32_t> GetAllFlagWriteTypes() override
 	{
-		return vector<uint32_t> {
+		vector<uint32_t> result {
 			IL_FLAGWRITE_NONE,
 
 			IL_FLAGWRITE_CR0_S, IL_FLAGWRITE_CR1_S, IL_FLAGWRITE_CR2_S, IL_FLAGWRITE_CR3_S,
@@ -1029,6 +1081,11 @@ class PowerpcArchitecture: public Architecture
 
 			IL_FLAGWRITE_INVALL
 		};
+
+		for (uint32_t fxm = 1; fxm <= 0xFF; fxm++)
+			result.push_back(IL_FLAGWRITE_MTCRF(fxm));
+
+		return result;
 	}
 
 	virtual string GetFlagWriteTypeName(uint32_t writeType) override
@@ -1116,6 +1173,11 @@ class PowerpcArchitecture: public Architecture
 				return "invall";
 
 			default:
+				if (IL_FLAGWRITE_IS_MTCRF(writeType)) {
+					char buf[16];
+					snprintf(buf, sizeof(buf), "mtcrf_%02x", writeType - IL_FLAGWRITE_MTCRF_BASE);
+					return buf;
+				}
 				MYLOG("ERROR: unrecognized writeType\n");
 				return "none";
 		}
@@ -1210,6 +1272,14 @@ class PowerpcArchitecture: public Architecture
 				return GetAllFlags();
 
 			default:
+				if (IL_FLAGWRITE_IS_MTCRF(writeType)) {
+					vector<uint32_t> result;
+					for (uint32_t field = 0; field < 8; field++)
+						if (writeType & (0x80 >> field))
+							for (uint32_t flag = field * 4; flag < field * 4 + 4; flag++)
+								result.push_back(flag);
+					return result;
+				}
 				return vector<uint32_t>();
 		}
 	}
@@ -1742,6 +1812,65 @@ class PowerpcArchitecture: public Architecture
 		return PPC_REG_LR;
 	}
 
+	/*************************************************************************/
+	/* intrinsics, only emitted by the compact lmw/stmw lifting */
+
+	virtual vector<uint32_t> GetAllIntrinsics() override
+	{
+		vector<uint32_t> result;
+
+		for (uint32_t i = 0; i < PPC_INTRIN_COUNT; i++)
+			result.push_back(i);
+
+		return result;
+	}
+
+	virtual string GetIntrinsicName(uint32_t intrinsic) override
+	{
+		char buf[16];
+
+		if (intrinsic >= PPC_INTRIN_COUNT)
+			return "";
+
+		if (intrinsic < PPC_INTRIN_STMW(0))
+			snprintf(buf, sizeof(buf), "lmw_r%d", intrinsic - PPC_INTRIN_LMW(0));
+		else
+			snprintf(buf, sizeof(buf), "stmw_r%d", intrinsic - PPC_INTRIN_STMW(0));
+
+		return buf;
+	}
+
+	virtual vector<NameAndType> GetIntrinsicInputs(uint32_t intrinsic) override
+	{
+		vector<NameAndType> result;
+
+		if (intrinsic >= PPC_INTRIN_COUNT)
+			return result;
+
+		result.push_back(NameAndType("ea", Type::IntegerType(4, false)));
+
+		/* stmw_rN takes rN..r31 after the address */
+		if (intrinsic >= PPC_INTRIN_STMW(0)) {
+			for (uint32_t n = intrinsic - PPC_INTRIN_STMW(0); n < 32; n++)
+				result.push_back(NameAndType("r" + to_string(n), Type::IntegerType(4, false)));
+		}
+
+		return result;
+	}
+
+	virtual vector<Confidence<Ref<Type>>> GetIntrinsicOutputs(uint32_t intrinsic) override
+	{
+		vector<Confidence<Ref<Type>>> result;
+
+		/* lmw_rN produces rN..r31 */
+		if (intrinsic < PPC_INTRIN_STMW(0)) {
+			for (uint32_t n = intrinsic - PPC_INTRIN_LMW(0); n < 32; n++)
+				result.push_back(Type::IntegerType(4, false));
+		}
+
+		return result;
+	}
+
 	/*************************************************************************/
 
 	virtual bool CanAssemble() override
@@ -1764,7 +1893,9 @@ class PowerpcArchitecture: public Architecture
 
 		/* assemble */
 		vector<uint8_t> byteEncoding;
-		if(assemble_multiline(src, byteEncoding, errors)) {
+		assemble_options opts = {};
+		opts.session = asmSession;
+		if(assemble_multiline(src, byteEncoding, errors, &opts)) {
 			MYLOG("assemble_multiline() failed, errors contains: %s\n", errors.c_str());
 			return false;
 		}
@@ -2504,6 +2635,67 @@ extern "C"
 		ppc_le->SetBinaryViewTypeConstant("ELF", "R_GLOBAL_DATA", 20);
 		ppc_le->SetBinaryViewTypeConstant("ELF", "R_JUMP_SLOT", 21);
 
+		/* lifting options, read by each architecture on first lift (see GetLiftOptions()) */
+		Ref<Settings> settings = Settings::Instance();
+		settings->RegisterGroup("ppc", "PowerPC");
+		settings->RegisterSetting("ppc.lift.crFields",
+			R"({
+				"title" : "Lift CR moves as whole fields",
+				"type" : "boolean",
+				"default" : false,
+				"description" : "Lift mfcr, mtcrf, mtocrf, mtcr and mcrf as single whole-register or field-mask moves instead of one instruction per condition register field. Takes effect for newly lifted functions after a restart."
+			})");
+		settings->RegisterSetting("ppc.lift.gprHelpers",
+			R"({
+				"title" : "Inline GPR save/restore helpers",
+				"type" : "boolean",
+				"default" : false,
+				"description" : "Recognize the EABI _savegpr_N, _restgpr_N and _restgpr_N_x helpers by their instructions when a binary is opened, and lift branches to them as the register saves/restores they do, instead of as calls, so the helpers aren't analyzed as functions. Helpers are known by address for the whole session, so with several PowerPC binaries open (or one rebased) the control flow at one binary's helper addresses can be wrong in another. Takes effect after a restart."
+			})");
+		settings->RegisterSetting("ppc.lift.compactMultiple",
+			R"({
+				"title" : "Compact multiple-word loads and stores",
+				"type" : "boolean",
+				"default" : false,
+				"description" : "Lift lmw, stmw and the GPR save/restore helpers as a single intrinsic instead of one load or store per register. Smaller IL, but stack slots of the saved registers are no longer visible to analysis. Takes effect after a restart."
+			})");
+		settings->RegisterSetting("ppc.lift.countedLoops",
+			R"({
+				"title" : "Bound mtctr/bdnz loops",
+				"type" : "boolean",
+				"default" : true,
+				"description" : "Lift a bdnz that closes a loop entered right after mtctr (and li) as a test of ctr before the decrement. When the loop is entered only through mtctr after li N, and its body neither writes ctr nor calls, the test is bounded so dataflow can bound the trip count. Takes effect after a restart."
+			})");
+
+		/* lifter coverage report, see GetUnimplementedLiftStats() */
+		PluginCommand::Register("PowerPC\\Log Unimplemented Lifts",
+			"Log the instructions most often lifted as unimplemented, with example addresses",
+			[](BinaryView*) {
+				LogInfo("PowerPC unimplemented lifts (id, count, examples):\n%s",
+					DumpUnimplementedLiftStats(64).c_str());
+			});
+
+		/* GPR helpers are found before analysis, as GetInstructionInfo() has to
+			know them too (see RecordGprHelpers()) */
+		BinaryViewType::RegisterBinaryViewFinalizationEvent([=](BinaryView* view) {
+			Ref<Architecture> arch = view->GetDefaultArchitecture();
+			if (!arch || (arch.GetPtr() != ppc && arch.GetPtr() != ppc64 &&
+			  arch.GetPtr() != ppc_le && arch.GetPtr() != ppc64_le))
+				return;
+			if (!Settings::Instance()->Get<bool>("ppc.lift.gprHelpers"))
+				return;
+
+			for (auto& segment : view->GetSegments())
+			{
+				if (!(segment->GetFlags() & SegmentExecutable))
+					continue;
+
+				DataBuffer code = view->ReadBuffer(segment->GetStart(), segment->GetLength());
+				RecordGprHelpers((const uint8_t *)code.GetData(), code.GetLength(), segment->GetStart(),
+					arch->GetEndianness() == LittleEndian);
+			}
+		});
+
 		ppc->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler());
 		ppc_le->RegisterRelocationHandler("ELF", new PpcElfRelocationHandler());
 		ppc_le->RegisterRelocationHandler("Mach-O", new PpcMachoRelocationHandler());
@@ -1,6 +1,44 @@
+/* all calls are reentrant and may be made from several threads at once */
+
+struct assemble_session;
+
+/* optional, NULL gets the defaults */
+struct assemble_options {
+	uint32_t seed; /* search PRNG seed, 0 for the fixed default */
+	bool steepest; /* score all 1-bit children per step and take the best, not the first better */
+	int racers; /* > 1: race this many searches on threads, first to win cancels the rest */
+	int max_failures; /* rejected candidates before giving up, 0 for the default (10000) */
+	uint32_t max_usecs; /* wall clock budget in microseconds, 0 for none */
+	assemble_session *session; /* assemble_multiline() line memo, NULL for none */
+};
+
 /* this is intended for use by BINJA */
-int assemble_multiline(const std::string& code, std::vector<uint8_t>& result, std::string& err);
+int assemble_multiline(const std::string& code, std::vector<uint8_t>& result, std::string& err,
+	const assemble_options *opts = NULL);
 
 /* this is lower level API intended to be use by benchmarking tools (eg: test_asm.cpp) */
-int assemble_single(std::string src, uint32_t addr, uint8_t *result, std::string& err, int& failures);
+int assemble_single(std::string src, uint32_t addr, uint8_t *result, std::string& err, int& failures,
+	const assemble_options *opts = NULL);
 int disasm_capstone(uint8_t *data, uint32_t addr, std::string& result, std::string& err);
+
+/* assemble_single() results are cached (LRU, thread safe), these tune and
+	inspect that; capacity 0 turns it off. Loading checks every entry against
+	capstone and fails (after loading the good ones) if any didn't match */
+void assemble_cache_configure(size_t capacity);
+void assemble_cache_clear();
+void assemble_cache_stats(uint64_t& hits, uint64_t& misses, size_t& entries);
+int assemble_cache_save(const std::string& path, std::string& err);
+int assemble_cache_load(const std::string& path, std::string& err);
+
+/* assemble_multiline() sessions remember each line it assembled (and the
+	address, for relative branches), pass one in assemble_options to
+	reassemble only changed lines */
+assemble_session *assemble_session_create();
+void assemble_session_destroy(assemble_session *session);
+void assemble_session_stats(assemble_session *session, uint64_t& hits, uint64_t& misses, size_t& lines);
+
+/* signature table access, intended for offline tools (eg: gen_fields.cpp) */
+size_t signature_count();
+std::string signature_get(size_t i, uint32_t& seed, uint32_t& mask);
+bool signature_constrained(size_t i);
+int signature_of(uint32_t insword, uint32_t addr, std::string& sig, std::vector<uint32_t>& operands, std::string& err);
@@ -0,0 +1,280 @@
+/* operand -> bit field maps for the direct encoder (encode_fields() in
+	assembler.cpp)
+
+	Keyed by the same signatures as lookup[], and sorted the same way. The
+	word is the signature's seed with every field cleared, then each operand
+	value placed in its field(s). An operand may feed more than one field
+	(eg: mr rA,rS is or rA,rS,rS) and a field may hold only some bits of its
+	operand (eg: the split sh of rldicr). Signatures without a row here fall
+	back to the genetic search.
+
+	Bit positions count from the lsb (bit 0), unlike the PPC manuals.
+
+	Inter-field constraints aren't encoded here, only noted on the rows;
+	the encoder and search enforce them from assembler.cpp's constraints[].
+
+	These rows cover the common integer and load/store signatures, checked
+	by hand. gen_fields.cpp derives rows for every signature of lookup[]
+	from capstone (see README.md); its output replaces this file, this
+	comment included.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string_view>
+
+#define FF_SIGNED 1  /* two's complement field (either the signed or unsigned range is accepted) */
+#define FF_ALIGNED 2 /* value must be a multiple of 4, stored shifted right by 2 (LI, BD, DS) */
+
+struct field {
+	uint8_t operand; /* index among the operand tokens (not opcode, not punctuation) */
+	uint8_t lo;      /* lowest bit */
+	uint8_t width;
+	uint8_t flags;   /* FF_* */
+	uint8_t vlo = 0; /* lowest bit of the (scaled) operand value held, usually 0 */
+};
+
+#define FIELDS_MAX 5
+
+struct field_map {
+	std::string_view sig;
+	uint8_t n;
+	struct field fields[FIELDS_MAX];
+};
+
+static constexpr struct field_map field_maps[] = {
+{                 "add . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                   "add GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "addc . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "addc GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "adde . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "adde GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "addi GPR , GPR , NUM", 3, {{0,21,5,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{               "addic . GPR , GPR , NUM", 3, {{0,21,5,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{                 "addic GPR , GPR , NUM", 3, {{0,21,5,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{                 "addis GPR , GPR , NUM", 3, {{0,21,5,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{                     "addme . GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                       "addme GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                     "addze . GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                       "addze GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                 "and . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "and GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                "andc . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                  "andc GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                "andi . GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,0,16,0}}},
+{               "andis . GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,0,16,0}}},
+{                                 "b NUM", 1, {{0,2,24,FF_SIGNED|FF_ALIGNED}}},
+{                                "ba NUM", 1, {{0,2,24,FF_SIGNED|FF_ALIGNED}}},
+{                              "bdnz NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                             "bdnzl NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "bdz NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "bdzl NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "beq CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "beq NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                       "beql CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "beql NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "bge CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "bge NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                       "bgel CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "bgel NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "bgt CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "bgt NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                       "bgtl CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "bgtl NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                                "bl NUM", 1, {{0,2,24,FF_SIGNED|FF_ALIGNED}}},
+{                               "bla NUM", 1, {{0,2,24,FF_SIGNED|FF_ALIGNED}}},
+{                        "ble CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "ble NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                       "blel CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "blel NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "blt CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "blt NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                       "bltl CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "bltl NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "bne CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "bne NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                       "bnel CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                              "bnel NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "bns CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "bns NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                        "bso CREG , NUM", 2, {{0,18,3,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                               "bso NUM", 1, {{0,2,14,FF_SIGNED|FF_ALIGNED}}},
+{                 "cmpd CREG , GPR , GPR", 3, {{0,23,3,0}, {1,16,5,0}, {2,11,5,0}}},
+{                        "cmpd GPR , GPR", 2, {{0,16,5,0}, {1,11,5,0}}},
+{                "cmpdi CREG , GPR , NUM", 3, {{0,23,3,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{                       "cmpdi GPR , NUM", 2, {{0,16,5,0}, {1,0,16,FF_SIGNED}}},
+{                "cmpld CREG , GPR , GPR", 3, {{0,23,3,0}, {1,16,5,0}, {2,11,5,0}}},
+{                       "cmpld GPR , GPR", 2, {{0,16,5,0}, {1,11,5,0}}},
+{               "cmpldi CREG , GPR , NUM", 3, {{0,23,3,0}, {1,16,5,0}, {2,0,16,0}}},
+{                      "cmpldi GPR , NUM", 2, {{0,16,5,0}, {1,0,16,0}}},
+{                "cmplw CREG , GPR , GPR", 3, {{0,23,3,0}, {1,16,5,0}, {2,11,5,0}}},
+{                       "cmplw GPR , GPR", 2, {{0,16,5,0}, {1,11,5,0}}},
+{               "cmplwi CREG , GPR , NUM", 3, {{0,23,3,0}, {1,16,5,0}, {2,0,16,0}}},
+{                      "cmplwi GPR , NUM", 2, {{0,16,5,0}, {1,0,16,0}}},
+{                 "cmpw CREG , GPR , GPR", 3, {{0,23,3,0}, {1,16,5,0}, {2,11,5,0}}},
+{                        "cmpw GPR , GPR", 2, {{0,16,5,0}, {1,11,5,0}}},
+{                "cmpwi CREG , GPR , NUM", 3, {{0,23,3,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{                       "cmpwi GPR , NUM", 2, {{0,16,5,0}, {1,0,16,FF_SIGNED}}},
+{                    "cntlzd . GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                      "cntlzd GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                    "cntlzw . GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                      "cntlzw GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                "divd . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "divd GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "divdu . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "divdu GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "divw . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "divw GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "divwu . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "divwu GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "eqv . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "eqv GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                     "extsb . GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                       "extsb GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                     "extsh . GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                       "extsh GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                     "extsw . GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                       "extsw GPR , GPR", 2, {{0,16,5,0}, {1,21,5,0}}},
+{                    "fabs . FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                      "fabs FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{             "fadd . FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "fadd FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{            "fadds . FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{              "fadds FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "fctiwz . FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                    "fctiwz FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{             "fdiv . FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "fdiv FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{            "fdivs . FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{              "fdivs FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                     "fmr . FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                       "fmr FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                    "fneg . FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                      "fneg FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                    "frsp . FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{                      "frsp FREG , FREG", 2, {{0,21,5,0}, {1,11,5,0}}},
+{             "fsub . FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "fsub FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{            "fsubs . FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{              "fsubs FREG , FREG , FREG", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "lbz GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "lbzu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lbzux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "lbzx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "ld GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}, {2,16,5,0}}},
+{                 "ldu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}, {2,16,5,0}}},
+{                   "ldx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "lfd FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{               "lfdu FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lfdx FREG , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "lfs FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{               "lfsu FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lfsx FREG , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "lha GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "lhau GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lhaux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "lhax GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "lhbrx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "lhz GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "lhzu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lhzux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "lhzx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                          "li GPR , NUM", 2, {{0,21,5,0}, {1,0,16,FF_SIGNED}}},
+{                         "lis GPR , NUM", 2, {{0,21,5,0}, {1,0,16,FF_SIGNED}}},
+{                 "lmw GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lwa GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}, {2,16,5,0}}},
+{                  "lwax GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "lwbrx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "lwz GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "lwzu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "lwzux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "lwzx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                              "mfcr GPR", 1, {{0,21,5,0}}},
+{                             "mfctr GPR", 1, {{0,21,5,0}}},
+{                              "mflr GPR", 1, {{0,21,5,0}}},
+{                          "mr GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {1,11,5,0}}},
+{                             "mtctr GPR", 1, {{0,21,5,0}}},
+{                              "mtlr GPR", 1, {{0,21,5,0}}},
+{               "mulhw . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "mulhw GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{              "mulhwu . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "mulhwu GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "mulld . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "mulld GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "mulli GPR , GPR , NUM", 3, {{0,21,5,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{               "mullw . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "mullw GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "nand . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                  "nand GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                       "neg . GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                         "neg GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                 "nor . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "nor GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                  "or . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                    "or GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                 "orc . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "orc GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "ori GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,0,16,0}}},
+{                  "oris GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,0,16,0}}},
+{  "rlwimi . GPR , GPR , NUM , NUM , NUM", 5, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}, {3,6,5,0}, {4,1,5,0}}},
+{    "rlwimi GPR , GPR , NUM , NUM , NUM", 5, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}, {3,6,5,0}, {4,1,5,0}}},
+{  "rlwinm . GPR , GPR , NUM , NUM , NUM", 5, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}, {3,6,5,0}, {4,1,5,0}}},
+{    "rlwinm GPR , GPR , NUM , NUM , NUM", 5, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}, {3,6,5,0}, {4,1,5,0}}},
+{   "rlwnm . GPR , GPR , GPR , NUM , NUM", 5, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}, {3,6,5,0}, {4,1,5,0}}},
+{     "rlwnm GPR , GPR , GPR , NUM , NUM", 5, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}, {3,6,5,0}, {4,1,5,0}}},
+{                 "sld . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "sld GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                 "slw . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "slw GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                "srad . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                  "srad GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                "sraw . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                  "sraw GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{               "srawi . GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                 "srawi GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                 "srd . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "srd GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                 "srw . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "srw GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                 "stb GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "stbu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "stbux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "stbx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "std GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}, {2,16,5,0}}},
+{                "stdu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,2,14,FF_SIGNED|FF_ALIGNED}, {2,16,5,0}}},
+{                  "stdx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "stfd FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{              "stfdu FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "stfdx FREG , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "stfs FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{              "stfsu FREG , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "stfsx FREG , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "sth GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "sthbrx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "sthu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "sthux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "sthx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "stmw GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "stw GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                "stwbrx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "stwu GPR , NUM ( GPR )", 3, {{0,21,5,0}, {1,0,16,FF_SIGNED}, {2,16,5,0}}},
+{                 "stwux GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "stwx GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "subf . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                  "subf GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "subfc . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "subfc GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{               "subfe . GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                 "subfe GPR , GPR , GPR", 3, {{0,21,5,0}, {1,16,5,0}, {2,11,5,0}}},
+{                "subfic GPR , GPR , NUM", 3, {{0,21,5,0}, {1,16,5,0}, {2,0,16,FF_SIGNED}}},
+{                    "subfme . GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                      "subfme GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                    "subfze . GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                      "subfze GPR , GPR", 2, {{0,21,5,0}, {1,16,5,0}}},
+{                 "xor . GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                   "xor GPR , GPR , GPR", 3, {{0,16,5,0}, {1,21,5,0}, {2,11,5,0}}},
+{                  "xori GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,0,16,0}}},
+{                 "xoris GPR , GPR , NUM", 3, {{0,16,5,0}, {1,21,5,0}, {2,0,16,0}}},
+};
@@ -184,3 +184,12 @@ powerpc_reg_to_str(uint32_t rid)
 	return cs_reg_name(handle_lil, rid);
 }
 
+extern "C" const char *
+powerpc_insn_to_str(uint32_t iid)
+{
+	if(!handle_lil) {
+		powerpc_init();
+	}
+
+	return cs_insn_name(handle_lil, iid);
+}
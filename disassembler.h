@@ -66,4 +66,5 @@ extern "C" int powerpc_decompose(const uint8_t *data, int size, uint32_t addr,
 extern "C" int powerpc_disassemble(struct decomp_result *, char *buf, size_t len);
 
 extern "C" const char *powerpc_reg_to_str(uint32_t rid);
+extern "C" const char *powerpc_insn_to_str(uint32_t iid);
 
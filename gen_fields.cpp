@@ -0,0 +1,419 @@
+/* derives the operand -> bit field maps of assembler_fields.h for every
+	signature in assembler.cpp's lookup[], by asking capstone
+
+	Like test_asm.cpp, this links against assembler.cpp and needs no binja:
+
+g++ -std=c++17 -O2 gen_fields.cpp assembler.cpp -o gen_fields -lcapstone -pthread
+./gen_fields assembler_fields.h > assembler_fields.new && mv assembler_fields.new assembler_fields.h
+
+	The header comment is gen_fields' own (HEADER_COMMENT), then the given
+	header's text from #pragma once up to the table is copied, then the
+	table is printed. For each signature:
+
+	1) every bit in the mask is flipped, from the seed and from a few random
+	   bases that still disassemble to the signature, until exactly one
+	   operand changes; that bit then belongs to that operand with weight
+	   (change in value), a negative weight being a sign bit
+	2) bits no single flip explains are flipped in pairs, which finds fields
+	   that must mirror each other (eg: mr rA,rS is or rA,rS,rS)
+	3) each operand's bits become fields: weights must be scale*2^k for a
+	   scale of 1 or 4 (FF_ALIGNED), every k up to the top one present, and
+	   runs of adjacent bits form one field (vlo = k of the run's first bit)
+	4) the map is kept only if random operand values encoded with it
+	   disassemble back to themselves
+
+	Bits still unexplained after 2) are inter-field constraints (extended
+	mnemonics, assembler.cpp's constraints[]) and are noted on the row.
+	Signatures without a map are listed in a comment after the table.
+*/
+
+/* */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/* c++ stuff */
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "assembler.h"
+#include "assembler_fields.h"
+
+#define PROBE_ADDR 0 /* relative branch targets print as displacements */
+#define PROBE_BASES 16 /* base words to try each bit flip from */
+#define VERIFY_TRIALS 64
+
+/* the generated file's leading comment, replacing the given header's */
+#define HEADER_COMMENT \
+"/* operand -> bit field maps for the direct encoder (encode_fields() in\n" \
+"	assembler.cpp), printed by gen_fields.cpp from capstone: regenerate\n" \
+"	rather than edit (see README.md)\n" \
+"\n" \
+"	Keyed by the same signatures as lookup[], and sorted the same way. The\n" \
+"	word is the signature's seed with every field cleared, then each operand\n" \
+"	value placed in its field(s). An operand may feed more than one field\n" \
+"	(eg: mr rA,rS is or rA,rS,rS) and a field may hold only some bits of its\n" \
+"	operand (eg: the split sh of rldicr). Signatures without a row here fall\n" \
+"	back to the genetic search; they're listed after the table, with why.\n" \
+"\n" \
+"	Bit positions count from the lsb (bit 0), unlike the PPC manuals.\n" \
+"\n" \
+"	Inter-field constraints aren't encoded here, only noted on the rows;\n" \
+"	the encoder and search enforce them from assembler.cpp's constraints[].\n" \
+"*/\n"
+
+struct probe_bit {
+	int bit;
+	int64_t weight;
+};
+
+static uint32_t rng_state = 0x1337;
+
+/* xorshift32, so the output is the same on every libc */
+static uint32_t next_random()
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+/* disassemble, only succeeding if the signature is the one being probed */
+static bool probe(uint32_t word, const string& sig, vector<uint32_t>& operands)
+{
+	string s, err;
+
+	if(signature_of(word, PROBE_ADDR, s, operands, err))
+		return false;
+
+	return s == sig;
+}
+
+/* the one operand that differs, or -1 */
+static int changed_operand(const vector<uint32_t>& a, const vector<uint32_t>& b)
+{
+	int changed = -1;
+
+	for(size_t i=0; i<a.size(); ++i) {
+		if(a[i] == b[i])
+			continue;
+		if(changed >= 0)
+			return -1;
+		changed = i;
+	}
+
+	return changed;
+}
+
+static int log2_exact(uint64_t x)
+{
+	int k = 0;
+
+	if(!x || (x & (x-1)))
+		return -1;
+	while(x >>= 1)
+		k++;
+
+	return k;
+}
+
+/* step 3: one operand's probed bits -> fields, returns -1 if they don't
+	look like a linear field */
+static int operand_fields(int operand, vector<probe_bit>& bits, vector<field>& fields, int& nbits, int& flags)
+{
+	map<int, vector<int>> by_k; /* value bit -> word bits holding it */
+	int64_t scale = -1;
+	int top = -1;
+
+	flags = 0;
+
+	for(auto& pb : bits) {
+		int64_t mag = pb.weight < 0 ? -pb.weight : pb.weight;
+		if(scale < 0 || mag < scale)
+			scale = mag;
+	}
+
+	if(scale == 4)
+		flags |= FF_ALIGNED;
+	else if(scale != 1)
+		return -1;
+
+	for(auto& pb : bits) {
+		int64_t mag = pb.weight < 0 ? -pb.weight : pb.weight;
+		int k = log2_exact(mag / scale);
+		if(k < 0 || mag % scale)
+			return -1;
+		if(pb.weight < 0)
+			flags |= FF_SIGNED;
+		by_k[k].push_back(pb.bit);
+		top = max(top, k);
+	}
+
+	/* every value bit present, each the same number of times (mirrors) */
+	size_t copies = by_k[0].size();
+	for(int k=0; k<=top; ++k) {
+		if(by_k[k].size() != copies || !copies)
+			return -1;
+		sort(by_k[k].begin(), by_k[k].end());
+	}
+
+	/* only the top bit may be the sign */
+	for(auto& pb : bits)
+		if(pb.weight < 0 && log2_exact(-pb.weight / scale) != top)
+			return -1;
+
+	for(size_t c=0; c<copies; ++c) {
+		int start = 0;
+		for(int k=1; k<=top+1; ++k) {
+			if(k <= top && by_k[k][c] == by_k[k-1][c] + 1)
+				continue;
+
+			field f;
+			f.operand = operand;
+			f.lo = by_k[start][c];
+			f.width = k - start;
+			f.flags = 0; /* filled in below */
+			f.vlo = start;
+			fields.push_back(f);
+			start = k;
+		}
+	}
+
+	for(auto& f : fields)
+		if(f.operand == operand)
+			f.flags = flags;
+
+	nbits = top + 1;
+	return 0;
+}
+
+/* step 4 */
+static bool verify(const string& sig, uint32_t seed, const vector<field>& fields,
+	const vector<int>& nbits, const vector<int>& flags, int& agreed)
+{
+	uint32_t cleared = seed;
+	for(auto& f : fields)
+		cleared &= ~(((1u << f.width) - 1) << f.lo);
+
+	agreed = 0;
+	for(int trial=0; trial<VERIFY_TRIALS; ++trial) {
+		vector<uint32_t> expected(nbits.size()), got;
+		uint32_t word = cleared;
+
+		for(size_t i=0; i<nbits.size(); ++i) {
+			uint32_t raw = next_random() & (uint32_t)(((uint64_t)1 << nbits[i]) - 1);
+			int64_t value = raw;
+
+			/* sign extend */
+			if((flags[i] & FF_SIGNED) && (raw >> (nbits[i]-1)))
+				value -= (int64_t)1 << nbits[i];
+			if(flags[i] & FF_ALIGNED)
+				value *= 4;
+			expected[i] = (uint32_t)value;
+
+			for(auto& f : fields)
+				if(f.operand == (int)i)
+					word |= ((raw >> f.vlo) & ((1u << f.width) - 1)) << f.lo;
+		}
+
+		/* landing on an extended mnemonic is fine, a wrong operand is not */
+		if(!probe(word, sig, got))
+			continue;
+		if(got != expected)
+			return false;
+		agreed++;
+	}
+
+	return agreed >= VERIFY_TRIALS/2;
+}
+
+static int derive(const string& sig, uint32_t seed, uint32_t mask, vector<field>& fields,
+	uint32_t& unexplained, string& why)
+{
+	vector<uint32_t> ops0, ops_base, ops_flip;
+
+	fields.clear();
+	unexplained = 0;
+
+	if(sig.find("FLAG") != string::npos) {
+		why = "flag operands have no value";
+		return -1;
+	}
+
+	if(!probe(seed, sig, ops0)) {
+		why = "seed doesn't disassemble to its signature";
+		return -1;
+	}
+
+	if(ops0.size() > FIELDS_MAX) {
+		why = "too many operands";
+		return -1;
+	}
+
+	vector<vector<probe_bit>> bits(ops0.size());
+
+	/* step 1 */
+	for(int bit=0; bit<32; ++bit) {
+		if(!(mask & (1u << bit)))
+			continue;
+
+		bool found = false;
+		for(int attempt=0; attempt<PROBE_BASES && !found; ++attempt) {
+			uint32_t base = seed;
+			if(attempt)
+				base ^= next_random() & mask & ~(1u << bit);
+
+			if(!probe(base, sig, ops_base) || !probe(base ^ (1u << bit), sig, ops_flip))
+				continue;
+
+			int op = changed_operand(ops_base, ops_flip);
+			if(op < 0)
+				continue;
+
+			int64_t weight = (int32_t)(ops_flip[op] - ops_base[op]);
+			if(base & (1u << bit))
+				weight = -weight;
+
+			bits[op].push_back({bit, weight});
+			found = true;
+		}
+
+		if(!found)
+			unexplained |= 1u << bit;
+	}
+
+	/* step 2 */
+	for(int b1=0; b1<32; ++b1) {
+		for(int b2=b1+1; b2<32; ++b2) {
+			if(!(unexplained & (1u << b1)) || !(unexplained & (1u << b2)))
+				continue;
+
+			uint32_t word = seed ^ (1u << b1) ^ (1u << b2);
+			if(!probe(word, sig, ops_flip))
+				continue;
+
+			int op = changed_operand(ops0, ops_flip);
+			if(op < 0)
+				continue;
+
+			int64_t weight = (int32_t)(ops_flip[op] - ops0[op]);
+			if(seed & (1u << b1))
+				weight = -weight;
+
+			bits[op].push_back({b1, weight});
+			bits[op].push_back({b2, weight});
+			unexplained &= ~((1u << b1) | (1u << b2));
+		}
+	}
+
+	/* step 3 */
+	vector<int> nbits(ops0.size()), flags(ops0.size());
+	for(size_t i=0; i<ops0.size(); ++i) {
+		if(bits[i].empty()) {
+			why = "operand " + to_string(i) + " has no bits";
+			return -1;
+		}
+		if(operand_fields(i, bits[i], fields, nbits[i], flags[i])) {
+			why = "operand " + to_string(i) + " isn't a linear field";
+			return -1;
+		}
+	}
+
+	if(fields.size() > FIELDS_MAX) {
+		why = "more than FIELDS_MAX fields";
+		return -1;
+	}
+
+	/* step 4 */
+	int agreed;
+	if(!verify(sig, seed, fields, nbits, flags, agreed)) {
+		why = "round trip failed (" + to_string(agreed) + "/" + to_string(VERIFY_TRIALS) + ")";
+		return -1;
+	}
+
+	return 0;
+}
+
+static const char *flags_tostr(int flags)
+{
+	switch(flags) {
+		case FF_SIGNED: return "FF_SIGNED";
+		case FF_ALIGNED: return "FF_ALIGNED";
+		case FF_SIGNED|FF_ALIGNED: return "FF_SIGNED|FF_ALIGNED";
+		default: return "0";
+	}
+}
+
+int main(int ac, char **av)
+{
+	int rc = -1;
+	FILE *fp = NULL;
+	char line[1024];
+	vector<string> skipped;
+	size_t nmapped = 0;
+	bool copying = false;
+
+	if(ac < 2) {
+		printf("usage: %s <current assembler_fields.h>\n", av[0]);
+		goto cleanup;
+	}
+
+	/* header text from #pragma once up to and including the table's
+		opening line, under our own comment */
+	fp = fopen(av[1], "r");
+	if(!fp) {
+		printf("ERROR: fopen(%s)\n", av[1]);
+		goto cleanup;
+	}
+	printf("%s\n", HEADER_COMMENT);
+	while(fgets(line, sizeof(line), fp)) {
+		if(!copying && strncmp(line, "#pragma once", 12))
+			continue;
+		copying = true;
+		printf("%s", line);
+		if(!strncmp(line, "static constexpr struct field_map field_maps[]", 46))
+			break;
+	}
+	fclose(fp);
+
+	/* lookup[] is already sorted by signature, so the rows come out sorted */
+	for(size_t i=0; i<signature_count(); ++i) {
+		uint32_t seed, mask, unexplained;
+		string sig = signature_get(i, seed, mask), why;
+		vector<field> fields;
+
+		if(derive(sig, seed, mask, fields, unexplained, why)) {
+			skipped.push_back(sig + ": " + why);
+			continue;
+		}
+
+		string quoted = "\"" + sig + "\"";
+		printf("{%40s, %zu, {", quoted.c_str(), fields.size());
+		for(size_t j=0; j<fields.size(); ++j) {
+			field& f = fields[j];
+			printf("%s{%d,%d,%d,%s", j ? ", " : "", f.operand, f.lo, f.width, flags_tostr(f.flags));
+			if(f.vlo)
+				printf(",%d", f.vlo);
+			printf("}");
+		}
+		printf("}},");
+		if(unexplained)
+			printf(" // constrained bits: 0x%08X", unexplained);
+		printf("\n");
+		nmapped++;
+	}
+	printf("};\n");
+
+	printf("\n/* %zu of %zu signatures mapped, no map for:\n", nmapped, signature_count());
+	for(auto& s : skipped)
+		printf("\t%s\n", s.c_str());
+	printf("*/\n");
+
+	rc = 0;
+	cleanup:
+	return rc;
+}
@@ -1,3 +1,11 @@
+#include <inttypes.h>
+
+#include <atomic>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include <binaryninjaapi.h>
 
 #include "disassembler.h"
@@ -23,6 +31,93 @@ using namespace BinaryNinja;
 #define MYLOG(...) while(0);
 //#define MYLOG BinaryNinja::LogDebug
 
+/* unimplemented lift telemetry: how often each capstone instruction id fell
+	through to il.Unimplemented(), with the first few addresses as examples */
+#define UNIMPL_EXAMPLES 4
+
+static std::atomic<uint64_t> unimplCount[PPC_INS_ENDING];
+static std::atomic<uint64_t> unimplExample[PPC_INS_ENDING][UNIMPL_EXAMPLES];
+
+/* the instruction currently being lifted on this thread, for
+	LiftUnimplemented(), and whether it was counted yet */
+static thread_local uint32_t liftingId;
+static thread_local uint64_t liftingAddr;
+static thread_local bool liftingCounted;
+
+static void CountUnimplemented(uint32_t id, uint64_t addr)
+{
+	if(id >= PPC_INS_ENDING)
+		id = PPC_INS_INVALID;
+
+	uint64_t n = unimplCount[id].fetch_add(1, std::memory_order_relaxed);
+	if(n < UNIMPL_EXAMPLES)
+		unimplExample[id][n].store(addr, std::memory_order_relaxed);
+}
+
+/* every Unimplemented() the lifter emits for an instruction comes from here,
+	so an instruction counts once however many of its parts are unlifted */
+static ExprId LiftUnimplemented(LowLevelILFunction &il)
+{
+	if(!liftingCounted) {
+		CountUnimplemented(liftingId, liftingAddr);
+		liftingCounted = true;
+	}
+
+	return il.Unimplemented();
+}
+
+std::vector<UnimplementedLiftStat> GetUnimplementedLiftStats(size_t topN)
+{
+	std::vector<UnimplementedLiftStat> result;
+
+	for(uint32_t id=0; id<PPC_INS_ENDING; ++id) {
+		UnimplementedLiftStat stat;
+		stat.id = id;
+		stat.count = unimplCount[id].load(std::memory_order_relaxed);
+		if(!stat.count)
+			continue;
+		stat.nexamples = std::min<uint64_t>(stat.count, UNIMPL_EXAMPLES);
+		for(size_t i=0; i<stat.nexamples; ++i)
+			stat.examples[i] = unimplExample[id][i].load(std::memory_order_relaxed);
+		result.push_back(stat);
+	}
+
+	std::sort(result.begin(), result.end(),
+		[](const UnimplementedLiftStat& a, const UnimplementedLiftStat& b) {
+			return a.count > b.count;
+		});
+
+	if(topN && result.size() > topN)
+		result.resize(topN);
+
+	return result;
+}
+
+std::string DumpUnimplementedLiftStats(size_t topN)
+{
+	std::string result;
+	char buf[256];
+
+	for(auto& stat : GetUnimplementedLiftStats(topN)) {
+		const char *name = powerpc_insn_to_str(stat.id);
+		snprintf(buf, sizeof(buf), "%-16s %10" PRIu64 "  e.g.", name ? name : "invalid", stat.count);
+		result += buf;
+		for(size_t i=0; i<stat.nexamples; ++i) {
+			snprintf(buf, sizeof(buf), " 0x%" PRIx64, stat.examples[i]);
+			result += buf;
+		}
+		result += "\n";
+	}
+
+	return result;
+}
+
+void ResetUnimplementedLiftStats()
+{
+	for(uint32_t id=0; id<PPC_INS_ENDING; ++id)
+		unimplCount[id].store(0, std::memory_order_relaxed);
+}
+
 static uint32_t genMask(uint32_t mb, uint32_t me)
 {
 	uint32_t maskBegin = ~0u >> mb;
@@ -38,7 +133,7 @@ static ExprId operToIL(LowLevelILFunction &il, struct cs_ppc_op *op,
 
 	if(!op) {
 		MYLOG("ERROR: operToIL() got NULL operand\n");
-		return il.Unimplemented();
+		return LiftUnimplemented(il);
 	}
 
 	switch(op->type) {
@@ -86,7 +181,7 @@ static ExprId operToIL(LowLevelILFunction &il, struct cs_ppc_op *op,
 		case PPC_OP_INVALID:
 		default:
 			MYLOG("ERROR: don't know how to convert operand to IL\n");
-			res = il.Unimplemented();
+			res = LiftUnimplemented(il);
 	}
 
 	switch(options) {
@@ -228,7 +323,359 @@ static bool LiftConditionalBranch(LowLevelILFunction& il, uint8_t bo, uint8_t bi
 }
 
 
-static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8_t* data, uint64_t addr, bool le)
+/* rN..r31 = [base + disp ...] (lmw) or [base + disp ...] = rN..r31 (stmw) */
+static void LoadStoreMultiple(LowLevelILFunction &il, bool load, uint32_t firstReg,
+	uint32_t base, int32_t disp, uint32_t options)
+{
+	if (options & PPC_IL_COMPACT_MULTIPLE) {
+		uint32_t n = firstReg - PPC_REG_R0;
+		std::vector<ExprId> params;
+		params.push_back(il.Add(4, il.Register(4, base), il.Const(4, disp)));
+
+		if (load) {
+			std::vector<RegisterOrFlag> outputs;
+			for (uint32_t reg = firstReg; reg <= PPC_REG_R31; reg++)
+				outputs.push_back(RegisterOrFlag::Register(reg));
+			il.AddInstruction(il.Intrinsic(outputs, PPC_INTRIN_LMW(n), params));
+		}
+		else {
+			for (uint32_t reg = firstReg; reg <= PPC_REG_R31; reg++)
+				params.push_back(il.Register(4, reg));
+			il.AddInstruction(il.Intrinsic(std::vector<RegisterOrFlag>(), PPC_INTRIN_STMW(n), params));
+		}
+		return;
+	}
+
+	for (uint32_t reg = firstReg; reg <= PPC_REG_R31; reg++)
+	{
+		ExprId ea = il.Add(4, il.Register(4, base), il.Const(4, disp + (reg - firstReg) * 4));
+
+		if (load)
+			il.AddInstruction(il.SetRegister(4, reg, il.Load(4, ea)));
+		else
+			il.AddInstruction(il.Store(4, ea, il.Register(4, reg)));
+	}
+}
+
+/* out-of-line GPR save/restore helpers of the 32-bit EABI (libgcc crtsavres),
+	which callers enter part way in at the first register they need:
+
+	_savegpr_N:   stw rN,-(32-N)*4(r11) ... stw r31,-4(r11); blr
+	_restgpr_N:   lwz rN,-(32-N)*4(r11) ... lwz r31,-4(r11); blr
+	_restgpr_N_x: lwz rN,-(32-N)*4(r11) ... lwz r0,4(r11); lwz r31,-4(r11);
+	              mtlr r0; mr r1,r11; blr
+
+	(so _restgpr_31_x starts at the lwz r0). GetInstructionInfo() can't read
+	branch targets, so helpers are found up front by RecordGprHelpers() and
+	both it and the lifter go by that table, keeping the CFG and the IL in
+	agreement. It can only be keyed by address, as GetInstructionInfo() has
+	no view, and entries are never dropped, so another open (or a rebased)
+	binary's helper addresses are in it too: the lifter checks a helper
+	against the code in its own view before lifting it as one, and the
+	feature is off by default (ppc.lift.gprHelpers) */
+#define GPR_HELPER_MAX_WORDS 24 /* 18 lwz, lwz r0, mtlr, mr, blr */
+
+#define PPC_WORD_BLR 0x4E800020
+#define PPC_WORD_MTLR_R0 0x7C0803A6
+#define PPC_WORD_MR_R1_R11 0x7D615B78
+#define PPC_WORD_LWZ_R0_4_R11 0x800B0004
+
+#define PPC_OPCD_LWZ 32u
+#define PPC_OPCD_STW 36u
+
+/* target -> kind | first register << 8, helpers only */
+static std::shared_mutex gprHelpersMutex;
+static std::unordered_map<uint64_t, uint32_t> gprHelpers;
+
+/* up to <count> instruction words at <addr> in the lifted function's view */
+static size_t ReadWords(LowLevelILFunction &il, uint64_t addr, uint32_t *words, size_t count, bool le)
+{
+	Ref<Function> func = il.GetFunction();
+	if (!func)
+		return 0;
+
+	Ref<BinaryView> view = func->GetView();
+	if (!view)
+		return 0;
+
+	size_t nwords = view->Read(words, addr, count * 4) / 4;
+
+	for (size_t i = 0; i < nwords; i++)
+		if (!le)
+			words[i] = bswap32(words[i]);
+
+	return nwords;
+}
+
+/* the helper entered at words[0], if any */
+static int MatchGprHelper(const uint32_t *words, size_t nwords, uint32_t *firstReg)
+{
+	size_t i = 0;
+	uint32_t opcd, reg;
+	bool loadsR0 = false;
+
+	if (nwords && words[0] == PPC_WORD_LWZ_R0_4_R11) {
+		loadsR0 = true;
+		i++;
+	}
+
+	if (i + 2 > nwords)
+		return GPR_HELPER_NONE;
+
+	opcd = words[i] >> 26;
+	reg = (words[i] >> 21) & 31;
+	if ((opcd != PPC_OPCD_LWZ && opcd != PPC_OPCD_STW) || reg < 14 || (loadsR0 && opcd != PPC_OPCD_LWZ))
+		return GPR_HELPER_NONE;
+
+	*firstReg = PPC_REG_R0 + reg;
+
+	/* rN..r31 at -(32-N)*4(r11) upward, _x may fetch the saved lr on the way */
+	for (; reg <= 31; reg++, i++)
+	{
+		if (opcd == PPC_OPCD_LWZ && !loadsR0 && i < nwords && words[i] == PPC_WORD_LWZ_R0_4_R11) {
+			loadsR0 = true;
+			i++;
+		}
+
+		uint32_t expected = (opcd << 26) | (reg << 21) | (11 << 16) | ((uint32_t)(-4 * (int32_t)(32 - reg)) & 0xFFFF);
+		if (i >= nwords || words[i] != expected)
+			return GPR_HELPER_NONE;
+	}
+
+	if (i >= nwords)
+		return GPR_HELPER_NONE;
+
+	if (opcd == PPC_OPCD_STW)
+		return words[i] == PPC_WORD_BLR ? GPR_HELPER_SAVE : GPR_HELPER_NONE;
+
+	if (!loadsR0 && words[i] == PPC_WORD_BLR)
+		return GPR_HELPER_REST;
+
+	if (!loadsR0 && words[i] == PPC_WORD_LWZ_R0_4_R11) {
+		loadsR0 = true;
+		i++;
+	}
+
+	if (loadsR0 && i + 3 <= nwords && words[i] == PPC_WORD_MTLR_R0 &&
+	  words[i+1] == PPC_WORD_MR_R1_R11 && words[i+2] == PPC_WORD_BLR)
+		return GPR_HELPER_REST_X;
+
+	return GPR_HELPER_NONE;
+}
+
+size_t RecordGprHelpers(const uint8_t *data, size_t len, uint64_t addr, bool le)
+{
+	uint32_t words[GPR_HELPER_MAX_WORDS];
+	size_t nwords = len / 4, found = 0;
+
+	for (size_t i = 0; i < nwords; i++)
+	{
+		uint32_t word = *(const uint32_t *)(data + 4*i);
+		if (!le)
+			word = bswap32(word);
+
+		/* every entry is a lwz/stw off r11, cheap to rule out */
+		if ((word & 0xFC1F0000) != (PPC_OPCD_LWZ << 26 | 11u << 16) &&
+		  (word & 0xFC1F0000) != (PPC_OPCD_STW << 26 | 11u << 16))
+			continue;
+
+		size_t n = std::min(nwords - i, (size_t)GPR_HELPER_MAX_WORDS);
+		for (size_t j = 0; j < n; j++)
+			words[j] = le ? *(const uint32_t *)(data + 4*(i+j)) : bswap32(*(const uint32_t *)(data + 4*(i+j)));
+
+		uint32_t firstReg;
+		int kind = MatchGprHelper(words, n, &firstReg);
+		if (kind == GPR_HELPER_NONE)
+			continue;
+
+		std::unique_lock<std::shared_mutex> lock(gprHelpersMutex);
+		gprHelpers[addr + 4*i] = kind | (firstReg << 8);
+		found++;
+	}
+
+	return found;
+}
+
+int GetGprHelper(uint64_t target, uint32_t *firstReg)
+{
+	std::shared_lock<std::shared_mutex> lock(gprHelpersMutex);
+
+	auto iter = gprHelpers.find(target);
+	if (iter == gprHelpers.end())
+		return GPR_HELPER_NONE;
+
+	*firstReg = iter->second >> 8;
+	return iter->second & 0xFF;
+}
+
+/* a b/bl to a GPR helper, lifted as the helper's effect instead of a call */
+static bool LiftGprHelperCall(LowLevelILFunction &il, uint64_t target, uint64_t addr, bool lk, bool le,
+  uint32_t options)
+{
+	uint32_t firstReg, viewFirstReg, words[GPR_HELPER_MAX_WORDS];
+	int kind = GetGprHelper(target, &firstReg);
+
+	if (kind == GPR_HELPER_NONE)
+		return false;
+
+	/* the table may hold another view's helper at this address */
+	size_t nwords = ReadWords(il, target, words, GPR_HELPER_MAX_WORDS, le);
+	if (MatchGprHelper(words, nwords, &viewFirstReg) != kind || viewFirstReg != firstReg)
+		return false;
+
+	if (lk)
+		il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.ConstPointer(4, addr + 4)));
+
+	LoadStoreMultiple(il, kind != GPR_HELPER_SAVE, firstReg, PPC_REG_R11,
+		-4 * (int32_t)(PPC_REG_R31 + 1 - firstReg), options);
+
+	if (kind == GPR_HELPER_REST_X) {
+		/* r0 = saved lr; lr = r0; r1 = r11 (pop the frame) */
+		il.AddInstruction(il.SetRegister(4, PPC_REG_R0,
+			il.Load(4, il.Add(4, il.Register(4, PPC_REG_R11), il.Const(4, 4)))));
+		il.AddInstruction(il.SetRegister(4, PPC_REG_LR, il.Register(4, PPC_REG_R0)));
+		il.AddInstruction(il.SetRegister(4, PPC_REG_R1, il.Register(4, PPC_REG_R11)));
+	}
+
+	/* the helper's blr comes back here only when it was called */
+	if (!lk || kind == GPR_HELPER_REST_X)
+		il.AddInstruction(il.Return(il.Register(4, PPC_REG_LR)));
+
+	return true;
+}
+
+
+/* bdnz back to a loop head that is entered right after "mtctr rX", eg:
+
+	    li    rX, N       (optional, N > 0)
+	    mtctr rX
+	loop:
+	    ...
+	    bdnz  loop
+
+	is lifted as:
+
+	    if (ctr != 1) { ctr = ctr - 1; goto loop } else ctr = 0
+
+	which is exactly ctr = ctr - 1; if (ctr != 0) goto loop, but tests ctr
+	before it changes. ctr can be 0 at the bdnz (the hardware wraps it and
+	branches), so the test only becomes ctr u> 1, which the value set
+	analysis can bound along with the trip count, when ctr is known to be in
+	1..N at the head: the li is there, the body neither writes ctr nor calls,
+	and the loop is entered only through the mtctr (see CountedLoopIsClosed) */
+#define PPC_WORD_MTCTR 0x7C0903A6 /* mtctr r0 */
+#define PPC_WORD_LI 0x38000000    /* li r0, 0 */
+
+#define COUNTED_LOOP_MAX_WORDS 256 /* longer bodies keep the != 1 test */
+
+#define PPC_OPCD_SC 17
+#define PPC_OPCD_BC 16
+#define PPC_OPCD_B 18
+#define PPC_OPCD_XL 19
+#define PPC_XO_BCLR 16
+#define PPC_XO_BCCTR 528
+
+/* the body [target, addr) neither writes ctr nor calls, and the blocks of
+	[target, addr] are only entered from each other or, at target, by
+	falling through from the block with the li and mtctr */
+static bool CountedLoopIsClosed(Architecture* arch, LowLevelILFunction &il, uint64_t target, uint64_t addr, bool le)
+{
+	uint32_t words[COUNTED_LOOP_MAX_WORDS];
+	size_t i, nwords = (addr - target) / 4;
+
+	if (nwords > COUNTED_LOOP_MAX_WORDS || ReadWords(il, target, words, nwords, le) != nwords)
+		return false;
+
+	for (i = 0; i < nwords; i++)
+	{
+		uint32_t opcd = words[i] >> 26;
+
+		/* mtctr, calls, returns, indirect branches, ctr decrementing bc */
+		if ((words[i] & ~(31 << 21) & ~1) == PPC_WORD_MTCTR)
+			return false;
+		if (opcd == PPC_OPCD_SC || ((opcd == PPC_OPCD_B || opcd == PPC_OPCD_BC) && (words[i] & 1)))
+			return false;
+		if (opcd == PPC_OPCD_XL)
+		{
+			uint32_t xo = (words[i] >> 1) & 0x3FF;
+			if (xo == PPC_XO_BCLR || xo == PPC_XO_BCCTR)
+				return false;
+		}
+		if (opcd == PPC_OPCD_BC && !(words[i] & (4 << 21)))
+			return false;
+	}
+
+	Ref<Function> func = il.GetFunction();
+	if (!func)
+		return false;
+
+	bool sawHead = false;
+	for (auto& block : func->GetBasicBlocks())
+	{
+		if (block->GetArchitecture() != arch || block->GetStart() < target || block->GetStart() > addr)
+			continue;
+
+		for (auto& edge : block->GetIncomingEdges())
+		{
+			Ref<BasicBlock> source = edge.target;
+
+			if (source->GetStart() >= target && source->GetEnd() <= addr + 4)
+				continue;
+
+			/* the li (if any) and mtctr lead into the head */
+			if (block->GetStart() == target && source->GetEnd() == target && source->GetStart() <= target - 8)
+				continue;
+
+			return false;
+		}
+
+		sawHead = sawHead || block->GetStart() == target;
+	}
+
+	return sawHead;
+}
+
+static bool LiftCountedLoop(Architecture* arch, LowLevelILFunction &il, uint64_t target, uint64_t addr, bool le)
+{
+	uint32_t words[2];
+	uint32_t reg;
+	bool bounded;
+
+	/* only loops within the function */
+	BNLowLevelILLabel *loopLabel = il.GetLabelForAddress(arch, target);
+	if (!loopLabel)
+		return false;
+
+	if (ReadWords(il, target - 8, words, 2, le) != 2)
+		return false;
+
+	if ((words[1] & ~(31 << 21)) != PPC_WORD_MTCTR)
+		return false;
+
+	reg = (words[1] >> 21) & 31;
+	bounded = (words[0] & 0xFFFF0000) == (PPC_WORD_LI | (reg << 21)) && (int16_t)(words[0] & 0xFFFF) > 0 &&
+		CountedLoopIsClosed(arch, il, target, addr, le);
+
+	ExprId cond;
+	if (bounded)
+		cond = il.CompareUnsignedGreaterThan(4, il.Register(4, PPC_REG_CTR), il.Const(4, 1));
+	else
+		cond = il.CompareNotEqual(4, il.Register(4, PPC_REG_CTR), il.Const(4, 1));
+
+	LowLevelILLabel againLabel, exitLabel;
+	il.AddInstruction(il.If(cond, againLabel, exitLabel));
+
+	il.MarkLabel(againLabel);
+	il.AddInstruction(il.SetRegister(4, PPC_REG_CTR, il.Sub(4, il.Register(4, PPC_REG_CTR), il.Const(4, 1))));
+	il.AddInstruction(il.Goto(*loopLabel));
+
+	il.MarkLabel(exitLabel);
+	il.AddInstruction(il.SetRegister(4, PPC_REG_CTR, il.Const(4, 0)));
+
+	return true;
+}
+
+static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8_t* data, uint64_t addr, bool le, uint32_t options)
 {
 	uint32_t insn = *(const uint32_t *) data;
 
@@ -251,6 +698,9 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 			if (!(insn & 2))
 				target += (uint32_t) addr;
 
+			if ((options & PPC_IL_GPR_HELPERS) && LiftGprHelperCall(il, target, addr, lk, le, options))
+				break;
+
 			BNLowLevelILLabel *label = il.GetLabelForAddress(arch, target);
 
 			if (label && !(lk && (target != (addr+4))))
@@ -289,6 +739,11 @@ static bool LiftBranches(Architecture* arch, LowLevelILFunction &il, const uint8
 			if (!(insn & 2))
 				target += (uint32_t) addr;
 
+			/* bdnz backward, without link */
+			if ((options & PPC_IL_COUNTED_LOOPS) && !lk && (bo & 0x16) == 0x10 && target < addr &&
+			  LiftCountedLoop(arch, il, target, addr, le))
+				break;
+
 			BNLowLevelILLabel *existingTakenLabel = il.GetLabelForAddress(arch, target);
 			BNLowLevelILLabel *existingFalseLabel = il.GetLabelForAddress(arch, addr + 4);
 
@@ -444,25 +899,91 @@ static void ByteReversedStore(LowLevelILFunction &il, struct cs_ppc* ppc, size_t
 	il.AddInstruction(il.Store(size, addr, val));                     // [(rA|0) + (rB)] = swap(rS)
 }
 
+/* field mask of mtcrf (FXM immediate) or mtocrf/mfocrf (capstone gives a crN) */
+static uint32_t CrFieldMask(cs_ppc_op *oper)
+{
+	if (oper->type == PPC_OP_REG && oper->reg >= PPC_REG_CR0 && oper->reg <= PPC_REG_CR7)
+		return 0x80 >> (oper->reg - PPC_REG_CR0);
+
+	return oper->imm & 0xFF;
+}
+
+/* CR[fields in fxm] = rS */
+static void MoveToConditionRegister(LowLevelILFunction &il, uint32_t reg, uint32_t fxm, uint32_t options)
+{
+	if (!fxm) {
+		il.AddInstruction(il.Nop());
+		return;
+	}
+
+	/* one write, the flag write type says which fields it covers */
+	if (options & PPC_IL_CR_FIELDS) {
+		il.AddInstruction(il.Or(4, il.Register(4, reg), il.Const(4, 0), IL_FLAGWRITE_MTCRF(fxm)));
+		return;
+	}
+
+	for (uint32_t test = 0x80, i = 0; test; test >>= 1, i++)
+	{
+		if (test & fxm)
+			il.AddInstruction(il.Or(4, il.Register(4, reg), il.Const(4, 0), IL_FLAGWRITE_MTCR0 + i));
+	}
+}
+
+/* the whole CR as a value, cr0's LT in the msb */
+static ExprId ConditionRegisterValue(LowLevelILFunction &il)
+{
+	ExprId cr = il.FlagBit(4, IL_FLAG_LT, 31);
+
+	for (uint32_t flag = IL_FLAG_LT + 1; flag <= IL_FLAG_SO_7; flag++)
+		cr = il.Or(4, cr, il.FlagBit(4, flag, 31 - flag));
+
+	return cr;
+}
+
+/* crD = crS */
+static void MoveConditionRegisterField(LowLevelILFunction &il, uint32_t crD, uint32_t crS, uint32_t options)
+{
+	if (crD == crS) {
+		il.AddInstruction(il.Nop());
+		return;
+	}
+
+	if (options & PPC_IL_CR_FIELDS) {
+		/* gather crS's bits at crD's positions, then write crD like mtcrf does */
+		ExprId val = il.FlagBit(4, crS * 4, 31 - crD * 4);
+		for (uint32_t i = 1; i < 4; i++)
+			val = il.Or(4, val, il.FlagBit(4, crS * 4 + i, 31 - (crD * 4 + i)));
+
+		il.AddInstruction(il.SetRegister(4, LLIL_TEMP(0), val));
+		il.AddInstruction(il.Or(4, il.Register(4, LLIL_TEMP(0)), il.Const(4, 0), IL_FLAGWRITE_MTCR0 + crD));
+		return;
+	}
+
+	for (uint32_t i = 0; i < 4; i++)
+		il.AddInstruction(il.SetFlag(crD * 4 + i, il.Flag(crS * 4 + i)));
+}
+
 /* returns TRUE - if this IL continues
           FALSE - if this IL terminates a block */
 bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
-  const uint8_t* data, uint64_t addr, decomp_result *res, bool le)
+  const uint8_t* data, uint64_t addr, decomp_result *res, bool le, uint32_t options)
 {
-	int i;
 	bool rc = true;
+	struct cs_insn *insn = &(res->insn);
+	struct cs_detail *detail = &(res->detail);
+	struct cs_ppc *ppc = &(detail->ppc);
+
+	liftingId = insn->id;
+	liftingAddr = addr;
+	liftingCounted = false;
 
 	/* bypass capstone path for *all* branching instructions; capstone
 	 * is too difficult to work with and is outright broken for some
 	 * branch instructions (bdnz, etc.)
 	 */
-	if (LiftBranches(arch, il, data, addr, le))
+	if (LiftBranches(arch, il, data, addr, le, options))
 		return true;
 
-	struct cs_insn *insn = &(res->insn);
-	struct cs_detail *detail = &(res->detail);
-	struct cs_ppc *ppc = &(detail->ppc);
-
 	/* create convenient access to instruction operands */
 	cs_ppc_op *oper0=NULL, *oper1=NULL, *oper2=NULL, *oper3=NULL, *oper4=NULL;
 	#define REQUIRE1OP if(!oper0) goto ReturnUnimpl;
@@ -699,7 +1220,7 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 
 		case PPC_INS_FCMPU:
 			REQUIRE3OPS
-			ei0 = il.FloatSub(4, il.Unimplemented(), il.Unimplemented(), (oper0->reg - PPC_REG_CR0) + IL_FLAGWRITE_INVL0);
+			ei0 = il.FloatSub(4, LiftUnimplemented(il), LiftUnimplemented(il), (oper0->reg - PPC_REG_CR0) + IL_FLAGWRITE_INVL0);
 			il.AddInstruction(ei0);
 			break;
 
@@ -765,22 +1286,30 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 			break;
 
 		case PPC_INS_MFCR:
+		case PPC_INS_MFOCRF: /* fields outside FXM are undefined, all of CR will do */
 			REQUIRE1OP
-			ei0 = il.Unimplemented();
+			if (options & PPC_IL_CR_FIELDS)
+				ei0 = ConditionRegisterValue(il);
+			else
+				ei0 = LiftUnimplemented(il);
 			ei0 = il.SetRegister(4, oper0->reg, ei0);
 			il.AddInstruction(ei0);
 			break;
 
 		case PPC_INS_MTCRF:
+		case PPC_INS_MTOCRF:
 			REQUIRE2OPS
-			for (uint8_t test = 0x80, i = 0; test; test >>= 1, i++)
-			{
-				if (test & oper0->imm)
-				{
-					ei0 = il.Or(4, il.Register(4, oper1->reg), il.Const(4, 0), IL_FLAGWRITE_MTCR0 + i);
-					il.AddInstruction(ei0);
-				}
-			}
+			MoveToConditionRegister(il, oper1->reg, CrFieldMask(oper0), options);
+			break;
+
+		case PPC_INS_MTCR: /* mtcrf 0xff, rS */
+			REQUIRE1OP
+			MoveToConditionRegister(il, oper0->reg, 0xFF, options);
+			break;
+
+		case PPC_INS_MCRF:
+			REQUIRE2OPS
+			MoveConditionRegisterField(il, oper0->reg - PPC_REG_CR0, oper1->reg - PPC_REG_CR0, options);
 			break;
 
 		case PPC_INS_EXTSB:
@@ -842,17 +1371,7 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 
 		case PPC_INS_LMW:
 			REQUIRE2OPS
-			for(i=oper0->reg; i<=PPC_REG_R31; ++i) {
-				ei0 = il.SetRegister(4,
-					i,             // dest
-					il.Load(4,     // source
-						operToIL(il, oper1, OTI_IMM_BIAS, (i-(oper0->reg))*4)
-					)
-				);
-
-				il.AddInstruction(ei0);
-			}
-
+			LoadStoreMultiple(il, true, oper0->reg, oper1->mem.base, oper1->mem.disp, options);
 			break;
 
 		/*
@@ -1157,17 +1676,7 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 
 		case PPC_INS_STMW:
 			REQUIRE2OPS
-			for(i=oper0->reg; i<=PPC_REG_R31; ++i) {
-				ei0 = il.Register(4, i); // source
-				ei1 = operToIL(il, oper1, OTI_IMM_BIAS, (i-(oper0->reg))*4);
-				il.AddInstruction(
-					il.Store(4,
-						ei1,
-						ei0
-					)
-				);
-			}
-
+			LoadStoreMultiple(il, false, oper0->reg, oper1->mem.base, oper1->mem.disp, options);
 			break;
 
 		/* store half word [with update] */
@@ -1520,7 +2029,7 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 			break;
 
 		case PPC_INS_RFI:
-			il.AddInstruction(il.Return(il.Unimplemented()));
+			il.AddInstruction(il.Return(LiftUnimplemented(il)));
 			break;
 
 		case PPC_INS_TRAP:
@@ -1801,11 +2310,9 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 		case PPC_INS_LXVDSX:
 		case PPC_INS_LXVW4X:
 		case PPC_INS_MBAR:
-		case PPC_INS_MCRF:
 		case PPC_INS_MFDCR:
 		case PPC_INS_MFFS:
 		case PPC_INS_MFMSR:
-		case PPC_INS_MFOCRF:
 		case PPC_INS_MFSPR:
 		case PPC_INS_MFSR:
 		case PPC_INS_MFSRIN:
@@ -1818,7 +2325,6 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 		case PPC_INS_MTFSF:
 		case PPC_INS_MTMSR:
 		case PPC_INS_MTMSRD:
-		case PPC_INS_MTOCRF:
 		case PPC_INS_MTSPR:
 		case PPC_INS_MTSR:
 		case PPC_INS_MTSRIN:
@@ -2198,7 +2704,6 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 		case PPC_INS_MFASR:
 		case PPC_INS_MFPVR:
 		case PPC_INS_MFTBU:
-		case PPC_INS_MTCR:
 		case PPC_INS_MTBR0:
 		case PPC_INS_MTBR1:
 		case PPC_INS_MTBR2:
@@ -2327,7 +2832,7 @@ bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction &il,
 			  addr, data[0], data[1], data[2], data[3],
 			  res->insn.mnemonic, res->insn.op_str);
 
-			il.AddInstruction(il.Unimplemented());
+			il.AddInstruction(LiftUnimplemented(il));
 	}
 
 	return rc;
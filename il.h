@@ -97,6 +97,12 @@ if a==b then c=0b001 (not setting SO, setting EQ)
 
 #define IL_FLAGWRITE_INVALL 40
 
+/* mtcrf as a single write, one type per field mask (FXM 1..255); each
+	selected field is written like IL_FLAGWRITE_MTCRn (see PPC_IL_CR_FIELDS) */
+#define IL_FLAGWRITE_MTCRF_BASE 0x100
+#define IL_FLAGWRITE_MTCRF(fxm) (IL_FLAGWRITE_MTCRF_BASE + (fxm))
+#define IL_FLAGWRITE_IS_MTCRF(fwt) ((fwt) > IL_FLAGWRITE_MTCRF_BASE && (fwt) <= IL_FLAGWRITE_MTCRF(0xFF))
+
 /* the different classes of writes to each cr */
 #define IL_FLAGCLASS_NONE 0
 #define IL_FLAGCLASS_CR0_S 1
@@ -172,5 +178,51 @@ if a==b then c=0b001 (not setting SO, setting EQ)
 #define IL_FLAGGROUP_CR7_EQ (70 + 4)
 #define IL_FLAGGROUP_CR7_NE (70 + 5)
 
-
-bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction& il, const uint8_t *data, uint64_t addr, decomp_result *res, bool le);
+/* telemetry on instructions that lifted (wholly or partly) to Unimplemented() */
+struct UnimplementedLiftStat
+{
+	uint32_t id; /* capstone instruction id, eg: PPC_INS_MFCR */
+	uint64_t count;
+	uint64_t examples[4]; /* first addresses it was hit at */
+	size_t nexamples;
+};
+
+std::vector<UnimplementedLiftStat> GetUnimplementedLiftStats(size_t topN=0);
+std::string DumpUnimplementedLiftStats(size_t topN=0);
+void ResetUnimplementedLiftStats();
+
+/* lifting options (bitmask), from the "ppc.lift.*" settings */
+#define PPC_IL_OPTIONS_DEFAULT 0
+/* mfcr, mtcrf/mtocrf/mtcr and mcrf as whole-register or field-mask moves,
+	instead of one IL instruction per CR field (flags stay the CR bits) */
+#define PPC_IL_CR_FIELDS 1
+/* b/bl to the EABI _savegpr_N/_restgpr_N/_restgpr_N_x helpers lift as the
+	helper's stores/loads (helpers found by RecordGprHelpers() below) */
+#define PPC_IL_GPR_HELPERS 2
+/* lmw/stmw (and the helpers above) as one intrinsic instead of a load or
+	store per register */
+#define PPC_IL_COMPACT_MULTIPLE 4
+/* bdnz closing a loop entered after mtctr (and li) tests ctr before
+	decrementing it, bounded (so analysis can bound the trip count) only for
+	loops proven to be entered through the li/mtctr and to keep ctr */
+#define PPC_IL_COUNTED_LOOPS 8
+
+/* EABI GPR save/restore helpers, see PPC_IL_GPR_HELPERS */
+#define GPR_HELPER_NONE 0
+#define GPR_HELPER_SAVE 1   /* _savegpr_N */
+#define GPR_HELPER_REST 2   /* _restgpr_N */
+#define GPR_HELPER_REST_X 3 /* _restgpr_N_x, also restores lr and pops the frame */
+
+/* record the helper entry points in <len> bytes of code at <addr>, returns
+	how many there were */
+size_t RecordGprHelpers(const uint8_t *data, size_t len, uint64_t addr, bool le);
+/* GPR_HELPER_* recorded at <target>, and the first register (PPC_REG_RN) */
+int GetGprHelper(uint64_t target, uint32_t *firstReg);
+
+/* intrinsics of PPC_IL_COMPACT_MULTIPLE, one per first register N */
+#define PPC_INTRIN_LMW(n) (n)         /* rN..r31 = lmw_rN(ea) */
+#define PPC_INTRIN_STMW(n) (32 + (n)) /* stmw_rN(ea, rN, ..., r31) */
+#define PPC_INTRIN_COUNT 64
+
+bool GetLowLevelILForPPCInstruction(Architecture *arch, LowLevelILFunction& il, const uint8_t *data, uint64_t addr, decomp_result *res, bool le,
+	uint32_t options=PPC_IL_OPTIONS_DEFAULT);
@@ -0,0 +1,286 @@
+/* profile guided tuning of the seeds and masks of assembler.cpp's lookup[]
+
+	Like test_asm.cpp, this links against assembler.cpp and needs no binja:
+
+g++ -std=c++17 -O2 refine_seeds.cpp assembler.cpp -o refine_seeds -lcapstone -pthread
+./refine_seeds trace <corpus> >> traces.txt
+./refine_seeds propose assembler.cpp traces.txt [...] > assembler.new && mv assembler.new assembler.cpp
+
+	trace assembles every line of the corpus (one instruction per line, blank
+	lines and // comments skipped) with the results cache off, and prints a
+	line per search: the winning word, the failures (rejected candidates) it
+	took, and its signature
+
+	propose reads traces, and for each signature with at least MIN_TRACES of
+	them that needed searching:
+
+	1) the seed's mask bits become the majority of the winners' bits, which
+	   minimizes the expected bits a search has to flip, if that word still
+	   disassembles to the signature
+	2) mask bits all winners agree on are dropped from the mask if flipping
+	   one in any winner leaves the signature, ie: it isn't an operand bit
+	   and the search only wastes candidates on it
+
+	Rows with inter-field constraints (signature_constrained()) are left
+	alone, a majority seed needn't satisfy them.
+	The given assembler.cpp is copied with the changed rows rewritten; what
+	changed, and the mean mask bits between seed and winner before and after,
+	go to stderr.
+*/
+
+/* */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+/* c++ stuff */
+#include <map>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "assembler.h"
+
+#define TRACE_ADDR 0 /* relative branch targets print as displacements */
+#define MIN_TRACES 16
+
+struct trace {
+	uint32_t winner;
+	int failures;
+};
+
+struct proposal {
+	uint32_t seed, mask;
+};
+
+static int popcount(uint32_t x)
+{
+	int n = 0;
+
+	for(; x; x &= x-1)
+		n++;
+
+	return n;
+}
+
+/* word is of the signature */
+static bool is_sig(uint32_t word, const string& sig)
+{
+	string s, err;
+	vector<uint32_t> operands;
+
+	return !signature_of(word, TRACE_ADDR, s, operands, err) && s == sig;
+}
+
+static int do_trace(const char *path)
+{
+	int rc = -1;
+	char line[1024];
+	uint8_t encoding[4];
+	vector<uint32_t> operands;
+
+	FILE *fp = fopen(path, "r");
+	if(!fp) {
+		printf("ERROR: fopen(%s)\n", path);
+		goto cleanup;
+	}
+
+	assemble_cache_configure(0);
+
+	while(fgets(line, sizeof(line), fp)) {
+		string text = line, sig, err;
+		size_t left = text.find_first_not_of(" \t\r\n");
+		size_t right = text.find_last_not_of(" \t\r\n");
+		if(left == string::npos || text.compare(left, 2, "//") == 0)
+			continue;
+		text = text.substr(left, right-left+1);
+
+		int failures;
+		uint32_t word;
+		if(assemble_single(text, TRACE_ADDR, encoding, err, failures)) {
+			fprintf(stderr, "%s: %s\n", text.c_str(), err.c_str());
+			continue;
+		}
+		memcpy(&word, encoding, 4);
+
+		if(signature_of(word, TRACE_ADDR, sig, operands, err))
+			continue;
+
+		printf("%08X %d %s\n", word, failures, sig.c_str());
+	}
+	fclose(fp);
+
+	rc = 0;
+	cleanup:
+	return rc;
+}
+
+static int read_traces(const char *path, map<string, vector<trace>>& traces)
+{
+	char line[1024];
+	uint32_t winner;
+	int failures, n;
+
+	FILE *fp = fopen(path, "r");
+	if(!fp) {
+		fprintf(stderr, "ERROR: fopen(%s)\n", path);
+		return -1;
+	}
+
+	while(fgets(line, sizeof(line), fp)) {
+		if(sscanf(line, "%x %d %n", &winner, &failures, &n) != 2)
+			continue;
+		string sig = line + n;
+		while(!sig.empty() && (sig.back() == '\n' || sig.back() == '\r'))
+			sig.pop_back();
+		traces[sig].push_back({winner, failures});
+	}
+	fclose(fp);
+
+	return 0;
+}
+
+static bool propose(const string& sig, uint32_t seed, uint32_t mask, const vector<trace>& traces,
+  proposal& p)
+{
+	bool searched = false;
+
+	for(auto& t : traces)
+		searched = searched || t.failures;
+	if(traces.size() < MIN_TRACES || !searched)
+		return false;
+
+	/* 1) majority of the winners' mask bits, ties keep the seed's */
+	p.seed = seed;
+	for(int bit=0; bit<32; ++bit) {
+		if(!(mask & (1u << bit)))
+			continue;
+
+		size_t ones = 0;
+		for(auto& t : traces)
+			ones += (t.winner >> bit) & 1;
+
+		if(2*ones > traces.size())
+			p.seed |= 1u << bit;
+		else
+		if(2*ones < traces.size())
+			p.seed &= ~(1u << bit);
+	}
+	if(!is_sig(p.seed, sig))
+		p.seed = seed;
+
+	/* 2) mask bits no winner varies and no winner can vary */
+	p.mask = mask;
+	for(int bit=0; bit<32; ++bit) {
+		uint32_t b = 1u << bit;
+		if(!(mask & b) || (p.seed & b) != (traces[0].winner & b))
+			continue;
+
+		bool fixed = true;
+		for(size_t i=0; i<traces.size() && fixed; ++i)
+			fixed = (traces[i].winner & b) == (p.seed & b) && !is_sig(traces[i].winner ^ b, sig);
+
+		if(fixed)
+			p.mask &= ~b;
+	}
+
+	return p.seed != seed || p.mask != mask;
+}
+
+/* the row as lookup[] has it, with the bit pattern and seed disassembly */
+static string table_row(const string& sig, uint32_t seed, uint32_t mask)
+{
+	char buf[256], pattern[33];
+	string text, err, quoted = "\"" + sig + "\"";
+
+	for(int bit=31; bit>=0; --bit)
+		pattern[31-bit] = (mask & (1u << bit)) ? 'x' : ((seed >> bit) & 1 ? '1' : '0');
+	pattern[32] = '\0';
+
+	if(disasm_capstone((uint8_t *)&seed, TRACE_ADDR, text, err))
+		text = "?";
+
+	snprintf(buf, sizeof(buf), "{%36s,{0x%08X,0x%08X}}, // %s  %s\n", quoted.c_str(), seed, mask,
+		pattern, text.c_str());
+	return buf;
+}
+
+static int do_propose(const char *table, int n_traces, char **trace_paths)
+{
+	int rc = -1;
+	char line[1024];
+	FILE *fp = NULL;
+	map<string, vector<trace>> traces;
+	map<string, proposal> proposals;
+	uint64_t before = 0, after = 0, n = 0;
+
+	for(int i=0; i<n_traces; ++i)
+		if(read_traces(trace_paths[i], traces))
+			goto cleanup;
+
+	for(size_t i=0; i<signature_count(); ++i) {
+		uint32_t seed, mask;
+		string sig = signature_get(i, seed, mask);
+		proposal p = {seed, mask};
+
+		auto iter = traces.find(sig);
+		if(iter == traces.end())
+			continue;
+
+		if(!signature_constrained(i) && propose(sig, seed, mask, iter->second, p)) {
+			proposals[sig] = p;
+			fprintf(stderr, "%s: seed %08X -> %08X, mask %08X -> %08X (%zu traces)\n",
+				sig.c_str(), seed, p.seed, mask, p.mask, iter->second.size());
+		}
+
+		for(auto& t : iter->second) {
+			before += popcount((t.winner ^ seed) & mask);
+			after += popcount((t.winner ^ p.seed) & p.mask);
+			n++;
+		}
+	}
+
+	fprintf(stderr, "%zu rows changed, mean mask bits from seed to winner over %" PRIu64 " traces: %.2f -> %.2f\n",
+		proposals.size(), n, n ? (double)before / n : 0.0, n ? (double)after / n : 0.0);
+
+	/* copy the table's file, rewriting changed rows */
+	fp = fopen(table, "r");
+	if(!fp) {
+		fprintf(stderr, "ERROR: fopen(%s)\n", table);
+		goto cleanup;
+	}
+	while(fgets(line, sizeof(line), fp)) {
+		char *q0 = line[0] == '{' ? strchr(line, '"') : NULL;
+		char *q1 = q0 ? strchr(q0+1, '"') : NULL;
+
+		if(q1 && !strncmp(q1+1, ",{0x", 4)) {
+			auto iter = proposals.find(string(q0+1, q1-q0-1));
+			if(iter != proposals.end()) {
+				printf("%s", table_row(iter->first, iter->second.seed, iter->second.mask).c_str());
+				continue;
+			}
+		}
+
+		printf("%s", line);
+	}
+	fclose(fp);
+
+	rc = 0;
+	cleanup:
+	return rc;
+}
+
+int main(int ac, char **av)
+{
+	if(ac == 3 && !strcmp(av[1], "trace"))
+		return do_trace(av[2]);
+
+	if(ac >= 4 && !strcmp(av[1], "propose"))
+		return do_propose(av[2], ac-3, av+3);
+
+	printf("usage: %s trace <corpus>\n", av[0]);
+	printf("       %s propose <assembler.cpp> <traces> [...]\n", av[0]);
+	return -1;
+}
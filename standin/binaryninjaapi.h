@@ -0,0 +1,325 @@
+/******************************************************************************
+
+Stand-in for the parts of binaryninjaapi.h that il.cpp (and the other
+non-architecture sources) use, so that the lifter can be compiled and timed
+without Binary Ninja:
+
+g++ -std=c++17 -O2 -g -Istandin test_lift.cpp il.cpp disassembler.cpp util.cpp -o test_lift -lcapstone
+
+Only the builder side of LowLevelILFunction exists here. Every call records an
+expression node (operation, size, flags, operands) and returns its index, just
+like the real builder, so expression counts and shapes can be measured. There
+are no labels for addresses (GetLabelForAddress() always returns NULL), which
+is what the real lifter sees for targets outside the current function.
+GetFunction() returns whatever the harness put in <function>, whose view is a
+plain buffer and whose basic blocks are whatever the harness added (none by
+default).
+
+Keep the method signatures in sync with the real API (minus source location
+arguments) so il.cpp compiles unmodified against either.
+
+******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#define BN_INVALID_EXPR ((size_t)-1)
+#define LLIL_TEMP(n) (0x80000000 | (n))
+
+enum BNLowLevelILOperation
+{
+	LLIL_NOP,
+	LLIL_SET_REG,
+	LLIL_SET_FLAG,
+	LLIL_LOAD,
+	LLIL_STORE,
+	LLIL_REG,
+	LLIL_CONST,
+	LLIL_CONST_PTR,
+	LLIL_FLAG,
+	LLIL_FLAG_BIT,
+	LLIL_ADD,
+	LLIL_ADC,
+	LLIL_SUB,
+	LLIL_SBB,
+	LLIL_AND,
+	LLIL_OR,
+	LLIL_XOR,
+	LLIL_LSL,
+	LLIL_LSR,
+	LLIL_ASR,
+	LLIL_ROL,
+	LLIL_MUL,
+	LLIL_MULS_DP,
+	LLIL_MULU_DP,
+	LLIL_DIVU,
+	LLIL_DIVS,
+	LLIL_NEG,
+	LLIL_NOT,
+	LLIL_SX,
+	LLIL_ZX,
+	LLIL_LOW_PART,
+	LLIL_JUMP,
+	LLIL_CALL,
+	LLIL_RET,
+	LLIL_IF,
+	LLIL_GOTO,
+	LLIL_FLAG_GROUP,
+	LLIL_CMP_E,
+	LLIL_CMP_NE,
+	LLIL_CMP_UGT,
+	LLIL_TEST_BIT,
+	LLIL_INTRINSIC,
+	LLIL_SYSCALL,
+	LLIL_TRAP,
+	LLIL_UNDEF,
+	LLIL_UNIMPL,
+	LLIL_FSUB,
+	LLIL_OPERATION_COUNT
+};
+
+struct BNLowLevelILLabel
+{
+	bool resolved;
+	size_t ref;
+	size_t operand;
+};
+
+namespace BinaryNinja
+{
+	typedef size_t ExprId;
+
+	/* not reference counted here, the harness owns everything */
+	template <class T>
+	class Ref
+	{
+		T* obj;
+
+		public:
+		Ref(T* o = NULL): obj(o) {}
+		T* operator->() const { return obj; }
+		operator T*() const { return obj; }
+		bool operator!() const { return obj == NULL; }
+		T* GetPtr() const { return obj; }
+	};
+
+	class Architecture
+	{
+	};
+
+	/* not part of the real API: the view is a single buffer at <start> */
+	class BinaryView
+	{
+		public:
+		uint64_t start = 0;
+		std::vector<uint8_t> data;
+
+		size_t Read(void* dest, uint64_t offset, size_t len)
+		{
+			if (offset < start || offset - start >= data.size())
+				return 0;
+			if (len > data.size() - (offset - start))
+				len = data.size() - (offset - start);
+			memcpy(dest, &data[offset - start], len);
+			return len;
+		}
+	};
+
+	class BasicBlock;
+
+	struct BasicBlockEdge
+	{
+		Ref<BasicBlock> target;
+	};
+
+	/* not part of the real API: the harness fills in the fields */
+	class BasicBlock
+	{
+		public:
+		Ref<Architecture> arch;
+		uint64_t start = 0, end = 0;
+		std::vector<BasicBlockEdge> incoming;
+
+		Ref<Architecture> GetArchitecture() const { return arch; }
+		uint64_t GetStart() const { return start; }
+		uint64_t GetEnd() const { return end; }
+		std::vector<BasicBlockEdge> GetIncomingEdges() const { return incoming; }
+	};
+
+	class Function
+	{
+		public:
+		Ref<BinaryView> view;
+		std::vector<Ref<BasicBlock>> blocks;
+
+		Ref<BinaryView> GetView() const { return view; }
+		std::vector<Ref<BasicBlock>> GetBasicBlocks() const { return blocks; }
+	};
+
+	struct RegisterOrFlag
+	{
+		bool isFlag;
+		uint32_t index;
+
+		static RegisterOrFlag Register(uint32_t reg) { return RegisterOrFlag{false, reg}; }
+		static RegisterOrFlag Flag(uint32_t flag) { return RegisterOrFlag{true, flag}; }
+	};
+
+	struct LowLevelILLabel: public BNLowLevelILLabel
+	{
+		LowLevelILLabel()
+		{
+			resolved = false;
+			ref = 0;
+			operand = 0;
+		}
+	};
+
+	class LowLevelILFunction
+	{
+		public:
+		struct Expr
+		{
+			BNLowLevelILOperation operation;
+			size_t size;
+			uint32_t flags;
+			uint64_t operands[4];
+		};
+
+		/* recorded state, public so harnesses can inspect it */
+		std::vector<Expr> exprs;
+		std::vector<ExprId> instrs;
+
+		/* the function being lifted, NULL unless the harness sets it */
+		Ref<Function> function;
+
+		Ref<Function> GetFunction() const { return function; }
+
+		/* not part of the real API: drop everything recorded so far, keeping
+			the storage so steady-state lifting does not allocate */
+		void Clear()
+		{
+			exprs.clear();
+			instrs.clear();
+		}
+
+		ExprId AddExpr(BNLowLevelILOperation operation, size_t size, uint32_t flags,
+			uint64_t a = 0, uint64_t b = 0, uint64_t c = 0, uint64_t d = 0)
+		{
+			exprs.push_back({operation, size, flags, {a, b, c, d}});
+			return exprs.size() - 1;
+		}
+
+		ExprId AddInstruction(ExprId expr)
+		{
+			instrs.push_back(expr);
+			return instrs.size() - 1;
+		}
+
+		/* control flow */
+		BNLowLevelILLabel* GetLabelForAddress(Architecture*, uint64_t)
+		{
+			return NULL;
+		}
+
+		void MarkLabel(BNLowLevelILLabel& label)
+		{
+			label.resolved = true;
+			label.ref = instrs.size();
+		}
+
+		ExprId Goto(BNLowLevelILLabel& label) { return AddExpr(LLIL_GOTO, 0, 0, label.ref); }
+		ExprId If(ExprId operand, BNLowLevelILLabel& t, BNLowLevelILLabel& f)
+		{
+			return AddExpr(LLIL_IF, 0, 0, operand, t.ref, f.ref);
+		}
+		ExprId Jump(ExprId dest) { return AddExpr(LLIL_JUMP, 0, 0, dest); }
+		ExprId Call(ExprId dest) { return AddExpr(LLIL_CALL, 0, 0, dest); }
+		ExprId Return(size_t dest) { return AddExpr(LLIL_RET, 0, 0, dest); }
+		ExprId SystemCall() { return AddExpr(LLIL_SYSCALL, 0, 0); }
+		ExprId Trap(int64_t num) { return AddExpr(LLIL_TRAP, 0, 0, num); }
+		ExprId Nop() { return AddExpr(LLIL_NOP, 0, 0); }
+		ExprId Undefined() { return AddExpr(LLIL_UNDEF, 0, 0); }
+		ExprId Unimplemented() { return AddExpr(LLIL_UNIMPL, 0, 0); }
+		/* records the output and parameter counts, not the lists */
+		ExprId Intrinsic(const std::vector<RegisterOrFlag>& outputs, uint32_t intrinsic,
+			const std::vector<ExprId>& params, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_INTRINSIC, 0, flags, outputs.size(), intrinsic, params.size());
+		}
+
+		/* registers, flags, memory */
+		ExprId Register(size_t size, uint32_t reg) { return AddExpr(LLIL_REG, size, 0, reg); }
+		ExprId SetRegister(size_t size, uint32_t reg, ExprId val, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_SET_REG, size, flags, reg, val);
+		}
+		ExprId Flag(uint32_t flag) { return AddExpr(LLIL_FLAG, 0, 0, flag); }
+		ExprId FlagBit(size_t size, uint32_t flag, size_t bitIndex)
+		{
+			return AddExpr(LLIL_FLAG_BIT, size, 0, flag, bitIndex);
+		}
+		ExprId FlagGroup(uint32_t semGroup) { return AddExpr(LLIL_FLAG_GROUP, 0, 0, semGroup); }
+		ExprId SetFlag(uint32_t flag, ExprId val) { return AddExpr(LLIL_SET_FLAG, 0, 0, flag, val); }
+		ExprId Load(size_t size, ExprId addr, uint32_t flags = 0) { return AddExpr(LLIL_LOAD, size, flags, addr); }
+		ExprId Store(size_t size, ExprId addr, ExprId val, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_STORE, size, flags, addr, val);
+		}
+		ExprId Const(size_t size, uint64_t val) { return AddExpr(LLIL_CONST, size, 0, val); }
+		ExprId ConstPointer(size_t size, uint64_t val) { return AddExpr(LLIL_CONST_PTR, size, 0, val); }
+
+		/* arithmetic */
+		ExprId Add(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_ADD, size, flags, a, b); }
+		ExprId AddCarry(size_t size, ExprId a, ExprId b, ExprId carry, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_ADC, size, flags, a, b, carry);
+		}
+		ExprId Sub(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_SUB, size, flags, a, b); }
+		ExprId SubBorrow(size_t size, ExprId a, ExprId b, ExprId carry, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_SBB, size, flags, a, b, carry);
+		}
+		ExprId And(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_AND, size, flags, a, b); }
+		ExprId Or(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_OR, size, flags, a, b); }
+		ExprId Xor(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_XOR, size, flags, a, b); }
+		ExprId ShiftLeft(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_LSL, size, flags, a, b); }
+		ExprId LogicalShiftRight(size_t size, ExprId a, ExprId b, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_LSR, size, flags, a, b);
+		}
+		ExprId ArithShiftRight(size_t size, ExprId a, ExprId b, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_ASR, size, flags, a, b);
+		}
+		ExprId RotateLeft(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_ROL, size, flags, a, b); }
+		ExprId Mult(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_MUL, size, flags, a, b); }
+		ExprId MultDoublePrecSigned(size_t size, ExprId a, ExprId b, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_MULS_DP, size, flags, a, b);
+		}
+		ExprId MultDoublePrecUnsigned(size_t size, ExprId a, ExprId b, uint32_t flags = 0)
+		{
+			return AddExpr(LLIL_MULU_DP, size, flags, a, b);
+		}
+		ExprId DivSigned(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_DIVS, size, flags, a, b); }
+		ExprId DivUnsigned(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_DIVU, size, flags, a, b); }
+		ExprId Neg(size_t size, ExprId a, uint32_t flags = 0) { return AddExpr(LLIL_NEG, size, flags, a); }
+		ExprId Not(size_t size, ExprId a, uint32_t flags = 0) { return AddExpr(LLIL_NOT, size, flags, a); }
+		ExprId SignExtend(size_t size, ExprId a, uint32_t flags = 0) { return AddExpr(LLIL_SX, size, flags, a); }
+		ExprId ZeroExtend(size_t size, ExprId a, uint32_t flags = 0) { return AddExpr(LLIL_ZX, size, flags, a); }
+		ExprId LowPart(size_t size, ExprId a, uint32_t flags = 0) { return AddExpr(LLIL_LOW_PART, size, flags, a); }
+		ExprId CompareEqual(size_t size, ExprId a, ExprId b) { return AddExpr(LLIL_CMP_E, size, 0, a, b); }
+		ExprId CompareNotEqual(size_t size, ExprId a, ExprId b) { return AddExpr(LLIL_CMP_NE, size, 0, a, b); }
+		ExprId CompareUnsignedGreaterThan(size_t size, ExprId a, ExprId b) { return AddExpr(LLIL_CMP_UGT, size, 0, a, b); }
+		ExprId TestBit(size_t size, ExprId a, ExprId b) { return AddExpr(LLIL_TEST_BIT, size, 0, a, b); }
+		ExprId FloatSub(size_t size, ExprId a, ExprId b, uint32_t flags = 0) { return AddExpr(LLIL_FSUB, size, flags, a, b); }
+	};
+}
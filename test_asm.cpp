@@ -1,8 +1,24 @@
 /* this is meant to be linked up against assembler.cpp for stress test and
 	benchmarking
 
-g++ -std=c++11 -O0 -g test_asm.cpp assembler.cpp -o test_asm -lcapstone
-
+g++ -std=c++17 -O0 -g test_asm.cpp assembler.cpp -o test_asm -lcapstone -pthread
+
+	./test_asm <file>           assemble a file with assemble_multiline()
+	./test_asm "<instruction>"  assemble one instruction
+	./test_asm random           round trip random words forever
+	./test_asm allocs [count]   heap allocations per assemble over count
+	                            random words (cache off)
+	./test_asm bench [options]  reproducible timing of count samples (cache
+	                            off), latency percentiles and throughput
+
+	bench options:
+	  -seed N                   sample PRNG seed (default 0x1337)
+	  -count N                  samples (default 1000, corpus: its length)
+	  -strata sig|opcode        sample round robin over the signatures or the
+	                            primary opcodes, count in all
+	                            (corpus: group by what lines assembled to)
+	  -corpus FILE              instructions to time, one per line
+	  -json                     machine readable output, for diffing
 */
 
 /* */
@@ -11,9 +27,14 @@ g++ -std=c++11 -O0 -g test_asm.cpp assembler.cpp -o test_asm -lcapstone
 #include <stdint.h>
 #include <string.h>
 #include <time.h>
+#include <inttypes.h>
 
 /* c++ stuff */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <map>
+#include <new>
 #include <string>
 #include <vector>
 using namespace std;
@@ -27,11 +48,370 @@ using namespace std;
 
 #include "assembler.h"
 
+#define TEST_ADDR 0xCAFEBAB0
+
 /*****************************************************************************/
-/* main */
+/* allocation counting */
 /*****************************************************************************/
 
-#define TEST_ADDR 0xCAFEBAB0
+/* every operator new in the process, capstone's own mallocs aren't seen but
+	the search only uses cs_disasm_iter() on a preallocated insn; atomic, as
+	the worker pool and raced searches allocate from other threads */
+static atomic<uint64_t> n_allocs(0);
+
+void *operator new(size_t size)
+{
+	n_allocs.fetch_add(1, memory_order_relaxed);
+	void *p = malloc(size ? size : 1);
+	if(!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+	free(p);
+}
+
+/*****************************************************************************/
+/* benchmark */
+/*****************************************************************************/
+
+/* the same seed, count and build give the same samples and the same searches,
+	so only the timings differ between runs; the results cache is off so every
+	sample is a search */
+#define BENCH_SEED_DEFAULT 0x1337
+#define BENCH_COUNT_DEFAULT 1000
+#define BENCH_TRIES 256 /* random words tried per stratified sample */
+
+#define STRATA_NONE 0
+#define STRATA_SIG 1 /* evenly over the assembler's signatures */
+#define STRATA_OPCODE 2 /* evenly over the 64 primary opcodes */
+
+struct bench_sample {
+	string src;
+	string stratum;
+	double usecs;
+	int failures;
+	int rc;
+};
+
+/* xorshift32, so samples are the same on every libc */
+static uint32_t next_random(uint32_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+/* word -> source, false if capstone doesn't know it */
+static bool bench_source(uint32_t word, string& src)
+{
+	string err;
+
+	if(disasm_capstone((uint8_t *)&word, TEST_ADDR, src, err))
+		return false;
+
+	return src != "undefined";
+}
+
+/* one sample of stratum i (a signature or a primary opcode), false if the
+	tries ran out */
+static bool bench_draw(int strata, size_t i, uint32_t& state, bench_sample& s)
+{
+	string sig, err;
+	vector<uint32_t> operands;
+	uint32_t sig_seed = i << 26, mask = 0x03FFFFFF;
+
+	if(strata == STRATA_SIG)
+		s.stratum = signature_get(i, sig_seed, mask);
+	else
+		s.stratum = to_string(i);
+
+	/* the seed with random bits under the mask, if a signature's it must stay one */
+	for(int k=0; k<BENCH_TRIES; ++k) {
+		uint32_t word = sig_seed ^ (next_random(state) & mask);
+		if(strata == STRATA_SIG && (signature_of(word, TEST_ADDR, sig, operands, err) || sig != s.stratum))
+			continue;
+		if(bench_source(word, s.src))
+			return true;
+	}
+
+	return false;
+}
+
+static void bench_generate(int strata, size_t count, uint32_t seed, vector<bench_sample>& samples)
+{
+	uint32_t state = seed ? seed : 1;
+	bench_sample s = {};
+
+	if(strata == STRATA_NONE) {
+		while(samples.size() < count) {
+			if(!bench_source(next_random(state), s.src))
+				continue;
+			samples.push_back(s);
+		}
+		return;
+	}
+
+	/* round robin over the strata from a random one, so a count below the
+		strata's isn't all from the first of them; stops early if a whole
+		round found nothing */
+	size_t n = strata == STRATA_SIG ? signature_count() : 64;
+	size_t i = next_random(state) % n, found = 1;
+	for(size_t tried = 0; samples.size() < count; ++tried, i = (i+1) % n) {
+		if(tried && tried % n == 0) {
+			if(!found)
+				break;
+			found = 0;
+		}
+		if(bench_draw(strata, i, state, s)) {
+			samples.push_back(s);
+			found++;
+		}
+	}
+}
+
+/* one instruction per line, blank lines and // comments skipped, cycled
+	through until count (all of it for 0) */
+static int bench_corpus(const char *path, size_t count, vector<bench_sample>& samples)
+{
+	int rc = -1;
+	char line[1024];
+	vector<string> lines;
+	bench_sample s = {};
+
+	FILE *fp = fopen(path, "r");
+	if(!fp) {
+		printf("ERROR: fopen(%s)\n", path);
+		goto cleanup;
+	}
+	while(fgets(line, sizeof(line), fp)) {
+		string text = line;
+		size_t left = text.find_first_not_of(" \t\r\n");
+		size_t right = text.find_last_not_of(" \t\r\n");
+		if(left == string::npos || text.compare(left, 2, "//") == 0)
+			continue;
+		lines.push_back(text.substr(left, right-left+1));
+	}
+	fclose(fp);
+
+	if(lines.empty()) {
+		printf("ERROR: %s has no instructions\n", path);
+		goto cleanup;
+	}
+
+	if(!count)
+		count = lines.size();
+	for(size_t i=0; i<count; ++i) {
+		s.src = lines[i % lines.size()];
+		samples.push_back(s);
+	}
+
+	rc = 0;
+	cleanup:
+	return rc;
+}
+
+/* nearest rank, of sorted values */
+static double percentile(const vector<double>& sorted, int p)
+{
+	if(sorted.empty())
+		return 0;
+
+	size_t rank = (p * sorted.size() + 99) / 100;
+	return sorted[rank ? rank-1 : 0];
+}
+
+/* what's reported for all the samples and for each stratum */
+struct bench_stats {
+	size_t n, errors;
+	double p50, p90, p99, max; /* usecs */
+	double failures; /* per assemble */
+	const bench_sample *worst; /* slowest */
+};
+
+static bench_stats bench_summarize(const vector<const bench_sample *>& v)
+{
+	bench_stats st = {};
+	vector<double> usecs;
+	uint64_t failuresSum = 0;
+
+	for(auto s : v) {
+		usecs.push_back(s->usecs);
+		failuresSum += s->failures;
+		if(s->rc)
+			st.errors++;
+		if(!st.worst || s->usecs > st.worst->usecs)
+			st.worst = s;
+	}
+	sort(usecs.begin(), usecs.end());
+
+	st.n = v.size();
+	st.p50 = percentile(usecs, 50);
+	st.p90 = percentile(usecs, 90);
+	st.p99 = percentile(usecs, 99);
+	st.max = st.n ? usecs.back() : 0;
+	st.failures = st.n ? (double)failuresSum / st.n : 0;
+	return st;
+}
+
+static string json_string(const string& s)
+{
+	string result = "\"";
+
+	for(char c : s) {
+		if(c == '"' || c == '\\')
+			result += '\\';
+		result += c;
+	}
+
+	return result + "\"";
+}
+
+/* one stratum's line of the report, json as an element of "by_stratum" */
+static void bench_print_stratum(bool json, bool first, const string& name, const bench_stats& st)
+{
+	if(json)
+		printf("%s\n\t\t{\"stratum\": %s, \"samples\": %zu, \"p50_usecs\": %.1f, \"max_usecs\": %.1f, \"failures_per_assemble\": %.2f}",
+			first ? "" : ",", json_string(name).c_str(), st.n, st.p50, st.max, st.failures);
+	else
+		printf("  %-40s n %4zu, p50 %10.1f, max %10.1f, failures/assemble %10.2f\n",
+			name.c_str(), st.n, st.p50, st.max, st.failures);
+}
+
+static int bench(int ac, char **av)
+{
+	int rc = -1;
+	uint32_t seed = BENCH_SEED_DEFAULT;
+	size_t count = 0;
+	int strata = STRATA_NONE;
+	const char *corpus = NULL;
+	bool json = false;
+	vector<bench_sample> samples;
+	uint8_t encoding[4];
+
+	for(int i=2; i<ac; ++i) {
+		if(!strcmp(av[i], "-seed") && i+1 < ac)
+			seed = strtoul(av[++i], NULL, 0);
+		else if(!strcmp(av[i], "-count") && i+1 < ac)
+			count = strtoul(av[++i], NULL, 0);
+		else if(!strcmp(av[i], "-strata") && i+1 < ac && !strcmp(av[i+1], "sig") && ++i)
+			strata = STRATA_SIG;
+		else if(!strcmp(av[i], "-strata") && i+1 < ac && !strcmp(av[i+1], "opcode") && ++i)
+			strata = STRATA_OPCODE;
+		else if(!strcmp(av[i], "-corpus") && i+1 < ac)
+			corpus = av[++i];
+		else if(!strcmp(av[i], "-json"))
+			json = true;
+		else {
+			printf("ERROR: unknown or incomplete option %s\n", av[i]);
+			goto cleanup;
+		}
+	}
+
+	if(corpus) {
+		if(bench_corpus(corpus, count, samples))
+			goto cleanup;
+	}
+	else {
+		bench_generate(strata, count ? count : BENCH_COUNT_DEFAULT, seed, samples);
+	}
+
+	{
+		assemble_cache_configure(0);
+
+		/* warm up the per-thread capstone handles and buffers */
+		int failures;
+		string err;
+		assemble_single("addi r3, r1, 8", TEST_ADDR, encoding, err, failures);
+
+		auto t0 = chrono::steady_clock::now();
+		for(auto& s : samples) {
+			auto t1 = chrono::steady_clock::now();
+			s.rc = assemble_single(s.src, TEST_ADDR, encoding, err, s.failures);
+			s.usecs = chrono::duration<double, micro>(chrono::steady_clock::now() - t1).count();
+
+			/* corpus lines are stratified by what they assembled to */
+			if(corpus && strata != STRATA_NONE && !s.rc) {
+				uint32_t word;
+				vector<uint32_t> operands;
+				memcpy(&word, encoding, 4);
+				if(strata == STRATA_OPCODE)
+					s.stratum = to_string(word >> 26);
+				else if(signature_of(word, TEST_ADDR, s.stratum, operands, err))
+					s.stratum = "?";
+			}
+		}
+		double wall = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+		/* overall and per stratum, strata in order of first appearance */
+		vector<const bench_sample *> all;
+		vector<string> order;
+		map<string, vector<const bench_sample *>> by_stratum;
+
+		for(auto& s : samples) {
+			all.push_back(&s);
+			if(strata != STRATA_NONE) {
+				auto& v = by_stratum[s.stratum];
+				if(v.empty())
+					order.push_back(s.stratum);
+				v.push_back(&s);
+			}
+		}
+
+		bench_stats st = bench_summarize(all);
+		vector<bench_stats> st_strata;
+		for(auto& key : order)
+			st_strata.push_back(bench_summarize(by_stratum[key]));
+
+		const char *strata_name = strata == STRATA_SIG ? "sig" : (strata == STRATA_OPCODE ? "opcode" : "none");
+
+		if(json) {
+			printf("{\n");
+			printf("\t\"seed\": %u,\n", seed);
+			printf("\t\"corpus\": %s,\n", corpus ? json_string(corpus).c_str() : "null");
+			printf("\t\"strata\": \"%s\",\n", strata_name);
+			printf("\t\"samples\": %zu,\n", st.n);
+			printf("\t\"errors\": %zu,\n", st.errors);
+			printf("\t\"wall_secs\": %.6f,\n", wall);
+			printf("\t\"assembles_per_sec\": %.1f,\n", wall > 0 ? st.n / wall : 0.0);
+			printf("\t\"failures_per_assemble\": %.2f,\n", st.failures);
+			printf("\t\"latency_usecs\": {\"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f},\n",
+				st.p50, st.p90, st.p99, st.max);
+			printf("\t\"worst\": %s,\n", st.worst ? json_string(st.worst->src).c_str() : "null");
+			printf("\t\"by_stratum\": [");
+			for(size_t i=0; i<order.size(); ++i)
+				bench_print_stratum(true, i == 0, order[i], st_strata[i]);
+			printf("%s]\n", order.empty() ? "" : "\n\t");
+			printf("}\n");
+		}
+		else {
+			printf("BENCH MODE! seed 0x%X, %s, strata %s\n", seed, corpus ? corpus : "random words", strata_name);
+			printf("samples: %zu, errors: %zu\n", st.n, st.errors);
+			printf("wall: %fs (%f assembles/sec)\n", wall, wall > 0 ? st.n / wall : 0.0);
+			printf("failures/assemble: %.2f\n", st.failures);
+			printf("latency (usecs): p50 %.1f, p90 %.1f, p99 %.1f, max %.1f (%s)\n",
+				st.p50, st.p90, st.p99, st.max, st.worst ? st.worst->src.c_str() : "");
+			for(size_t i=0; i<order.size(); ++i)
+				bench_print_stratum(false, i == 0, order[i], st_strata[i]);
+		}
+	}
+
+	rc = 0;
+	cleanup:
+	return rc;
+}
+
+/*****************************************************************************/
+/* main */
+/*****************************************************************************/
 
 int main(int ac, char **av)
 {
@@ -53,7 +433,12 @@ int main(int ac, char **av)
 	#define MODE_FILE 0
 	#define MODE_RANDOM 1
 	#define MODE_SINGLE 2
+	#define MODE_ALLOCS 3
 	int mode;
+	if(ac > 1 && !strcmp(av[1], "bench")) {
+		return bench(ac, av);
+	}
+	else
 	if(ac > 1) {
 		struct stat st;
 		stat(av[1], &st);
@@ -65,6 +450,10 @@ int main(int ac, char **av)
 			printf("RANDOM MODE!\n");
 			mode = MODE_RANDOM;
 		}
+		else if(!strcmp(av[1], "allocs")) {
+			printf("ALLOCS MODE!\n");
+			mode = MODE_ALLOCS;
+		}
 		else {
 			printf("SINGLE MODE!\n");
 			mode = MODE_SINGLE;
@@ -177,6 +566,54 @@ int main(int ac, char **av)
 		return 0;
 	}
 
+	if(mode == MODE_ALLOCS) {
+		int count = ac > 2 ? atoi(av[2]) : 1000;
+		int failures, assembled = 0;
+		uint64_t failuresSum = 0;
+		size_t allocsSum = 0, allocsMin = (size_t)-1, allocsMax = 0;
+		string src, err, srcMax;
+
+		/* every call searches, and the per-thread buffers get warmed up */
+		assemble_cache_configure(0);
+		assemble_single("addi r3, r1, 8", TEST_ADDR, encoding, err, failures);
+
+		while(assembled < count) {
+			insWord = (rand()<<16) | rand();
+			if(0 != disasm_capstone((uint8_t *)&insWord, TEST_ADDR, src, err)) {
+				printf("ERROR: %s\n", err.c_str());
+				goto cleanup;
+			}
+			if(src == "undefined")
+				continue;
+
+			uint64_t before = n_allocs.load(memory_order_relaxed);
+			if(assemble_single(src, TEST_ADDR, encoding, err, failures)) {
+				printf("ERROR: %08X: %s: %s\n", insWord, src.c_str(), err.c_str());
+				goto cleanup;
+			}
+			size_t allocs = n_allocs.load(memory_order_relaxed) - before;
+
+			allocsSum += allocs;
+			allocsMin = min(allocsMin, allocs);
+			if(allocs > allocsMax) {
+				allocsMax = allocs;
+				srcMax = src;
+			}
+			failuresSum += failures;
+			assembled++;
+		}
+
+		/* setup (tokens, signature) allocates a little, the search shouldn't,
+			so allocations per assemble shouldn't grow with failures */
+		printf("assembles: %d, candidates rejected: %" PRIu64 "\n", assembled, failuresSum);
+		printf("allocations per assemble: avg %.2f, min %zu, max %zu (%s)\n",
+			(double)allocsSum / assembled, allocsMin, allocsMax, srcMax.c_str());
+		printf("allocations per 1000 rejected candidates: %.3f\n",
+			failuresSum ? 1000.0 * allocsSum / failuresSum : 0.0);
+
+		return 0;
+	}
+
 	rc = 0;
 	cleanup:
 	return rc;
@@ -0,0 +1,214 @@
+/******************************************************************************
+
+Tests just the lifter (il.cpp) against the recording LowLevelILFunction in
+standin/binaryninjaapi.h, so lifting can be timed and profiled (eg: perf) on a
+machine without Binary Ninja.
+
+`./test_lift random [count] [seed]` lifts <count> random valid words
+`./test_lift <file> [be|le]` lifts every aligned word of the file
+
+Options (before the mode) select the lifting options, see il.h:
+  -crfields    PPC_IL_CR_FIELDS
+  -gprhelpers  PPC_IL_GPR_HELPERS (helpers are recorded from the lifted words)
+  -compact     PPC_IL_COMPACT_MULTIPLE
+  -loops       PPC_IL_COUNTED_LOOPS
+
+g++ -std=c++17 -O2 -g -Istandin test_lift.cpp il.cpp disassembler.cpp util.cpp -o test_lift -lcapstone
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+using namespace std;
+
+#include <binaryninjaapi.h>
+using namespace BinaryNinja;
+
+#include "disassembler.h"
+#include "il.h"
+#include "util.h"
+
+#define TEST_ADDR 0x10000000
+#define TOP_N 32
+
+struct id_stats {
+	uint64_t count;
+	uint64_t exprs;
+	uint64_t instrs;
+	uint64_t unimpl;
+};
+
+/* xorshift32, so "random" corpora are the same on every libc */
+static uint32_t next_random(uint32_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+static int read_words(const char *path, vector<uint32_t>& words)
+{
+	FILE *fp = fopen(path, "rb");
+	if(!fp) {
+		printf("ERROR: fopen(%s)\n", path);
+		return -1;
+	}
+
+	uint8_t buf[4];
+	while(fread(buf, 1, 4, fp) == 4) {
+		/* store as host word of the in-memory bytes, like il.cpp receives */
+		uint32_t word;
+		memcpy(&word, buf, 4);
+		words.push_back(word);
+	}
+	fclose(fp);
+
+	return 0;
+}
+
+int main(int ac, char **av)
+{
+	int rc = -1;
+	bool lil_end = false;
+	uint32_t options = PPC_IL_OPTIONS_DEFAULT;
+	vector<uint32_t> words;
+
+	while(ac > 1 && av[1][0] == '-') {
+		if(!strcasecmp(av[1], "-crfields"))
+			options |= PPC_IL_CR_FIELDS;
+		else if(!strcasecmp(av[1], "-gprhelpers"))
+			options |= PPC_IL_GPR_HELPERS;
+		else if(!strcasecmp(av[1], "-compact"))
+			options |= PPC_IL_COMPACT_MULTIPLE;
+		else if(!strcasecmp(av[1], "-loops"))
+			options |= PPC_IL_COUNTED_LOOPS;
+		else {
+			printf("ERROR: unknown option %s\n", av[1]);
+			goto cleanup;
+		}
+		ac--;
+		av++;
+	}
+
+	if(ac <= 1) {
+		printf("send argument \"[options] random [count] [seed]\" or \"[options] <file> [be|le]\"\n");
+		goto cleanup;
+	}
+
+	powerpc_init();
+
+	if(!strcasecmp(av[1], "random")) {
+		size_t count = (ac > 2) ? strtoul(av[2], NULL, 0) : 1000000;
+		uint32_t state = (ac > 3) ? strtoul(av[3], NULL, 0) : 0x1337;
+		if(!state) state = 1;
+
+		/* only keep words capstone can decode, stored in big endian */
+		struct decomp_result res;
+		while(words.size() < count) {
+			uint32_t word = next_random(state);
+			uint32_t be_word = bswap32(word);
+			if(powerpc_decompose((const uint8_t *)&be_word, 4, TEST_ADDR, false, &res))
+				continue;
+			words.push_back(be_word);
+		}
+	}
+	else {
+		if(ac > 2 && !strcasecmp(av[2], "le"))
+			lil_end = true;
+		if(read_words(av[1], words))
+			goto cleanup;
+	}
+
+	printf("lifting %zu words (%s endian, options 0x%x)\n", words.size(), lil_end ? "little" : "big", options);
+
+	{
+		Architecture arch;
+		LowLevelILFunction il;
+
+		/* the words double as the view, so branch targets among them can be read */
+		BinaryView view;
+		Function func;
+		view.start = TEST_ADDR;
+		view.data.resize(words.size() * 4);
+		memcpy(view.data.data(), words.data(), view.data.size());
+		func.view = &view;
+		il.function = &func;
+		if(options & PPC_IL_GPR_HELPERS)
+			printf("%zu GPR helper entries\n", RecordGprHelpers(view.data.data(), view.data.size(), TEST_ADDR, lil_end));
+		struct decomp_result res;
+		map<uint32_t, id_stats> stats;
+		size_t nlifted = 0, nundef = 0;
+
+		/* pass 1: decompose only, so the lifter's share can be separated out */
+		clock_t t0 = clock();
+		for(size_t i=0; i<words.size(); ++i) {
+			if(powerpc_decompose((const uint8_t *)&words[i], 4, TEST_ADDR + 4*i, lil_end, &res))
+				nundef++;
+		}
+		double t_decomp = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+		/* pass 2: decompose and lift, the same work as GetInstructionLowLevelIL() */
+		uint64_t total_exprs = 0, total_instrs = 0;
+		t0 = clock();
+		for(size_t i=0; i<words.size(); ++i) {
+			uint64_t addr = TEST_ADDR + 4*i;
+			const uint8_t *data = (const uint8_t *)&words[i];
+
+			if(powerpc_decompose(data, 4, addr, lil_end, &res))
+				continue;
+
+			il.Clear();
+			GetLowLevelILForPPCInstruction(&arch, il, data, addr, &res, lil_end, options);
+			nlifted++;
+
+			id_stats& s = stats[res.insn.id];
+			s.count += 1;
+			s.exprs += il.exprs.size();
+			s.instrs += il.instrs.size();
+			for(size_t j=0; j<il.exprs.size(); ++j)
+				if(il.exprs[j].operation == LLIL_UNIMPL)
+					s.unimpl += 1;
+			total_exprs += il.exprs.size();
+			total_instrs += il.instrs.size();
+		}
+		double t_total = (double)(clock() - t0) / CLOCKS_PER_SEC;
+		double t_lift = t_total - t_decomp;
+
+		printf("undecodable: %zu, lifted: %zu\n", nundef, nlifted);
+		printf("decompose+lift: %fs (%f instructions/sec)\n", t_total, nlifted/t_total);
+		if(t_lift > 0)
+			printf("lift only (est): %fs (%f instructions/sec)\n", t_lift, nlifted/t_lift);
+		if(nlifted)
+			printf("expressions/instruction: %f, IL instructions/instruction: %f\n",
+				(double)total_exprs/nlifted, (double)total_instrs/nlifted);
+
+		/* per capstone id, most expensive (by total expressions) first */
+		vector<pair<uint32_t, id_stats>> sorted(stats.begin(), stats.end());
+		sort(sorted.begin(), sorted.end(),
+			[](const pair<uint32_t, id_stats>& a, const pair<uint32_t, id_stats>& b) {
+				return a.second.exprs > b.second.exprs;
+			});
+
+		printf("\n%-12s %10s %10s %10s %10s\n", "id", "count", "exprs/ins", "il/ins", "unimpl");
+		for(size_t i=0; i<sorted.size() && i<TOP_N; ++i) {
+			id_stats& s = sorted[i].second;
+			printf("%-12s %10" PRIu64 " %10.2f %10.2f %10" PRIu64 "\n",
+				cs_insn_name(res.handle, sorted[i].first), s.count,
+				(double)s.exprs/s.count, (double)s.instrs/s.count, s.unimpl);
+		}
+
+		printf("\nmost frequent unimplemented lifts:\n%s", DumpUnimplementedLiftStats(TOP_N).c_str());
+	}
+
+	rc = 0;
+	cleanup:
+	return rc;
+}
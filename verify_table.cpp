@@ -0,0 +1,179 @@
+/* round trips every signature of assembler.cpp's lookup[]: valid words of the
+	signature are disassembled with capstone, assembled back with
+	assemble_single(), and the result disassembled again, which must give the
+	same text (the same word isn't required, eg: reserved bits may differ)
+
+	Like test_asm.cpp, this links against assembler.cpp and needs no binja:
+
+g++ -std=c++17 -O2 verify_table.cpp assembler.cpp -o verify_table -lcapstone -pthread
+./verify_table [samples per signature] [threads]
+
+	threads defaults to, and is capped at, the hardware's threads.
+	Samples are the signature's seed, then the seed with random mask bits for
+	as long as the word still disassembles to the signature. Each signature
+	has its own PRNG stream, so the samples don't depend on the thread count.
+	Signatures are printed in table order with their round trip rate and the
+	median/max failures (rejected candidates) the searches took, then totals.
+	Exits nonzero if any sample didn't round trip.
+*/
+
+/* */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+/* c++ stuff */
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include "assembler.h"
+
+#define VERIFY_ADDR 0x10000000
+#define SAMPLES_DEFAULT 16
+#define SAMPLE_TRIES 64 /* random words tried per sample */
+
+struct sig_result {
+	string sig;
+	int n; /* samples found */
+	int ok; /* of those, round tripped */
+	int median, max; /* failures */
+	string example; /* a sample that didn't round trip */
+};
+
+/* xorshift32, so the samples are the same on every libc */
+static uint32_t next_random(uint32_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+/* word of the signature, or false if the tries ran out */
+static bool sample_word(const string& sig, uint32_t seed, uint32_t mask, bool first,
+  uint32_t& state, uint32_t& word)
+{
+	string s, err;
+	vector<uint32_t> operands;
+
+	for(int i=0; i<SAMPLE_TRIES; ++i) {
+		word = first ? seed : seed ^ (next_random(state) & mask);
+		if(!signature_of(word, VERIFY_ADDR, s, operands, err) && s == sig)
+			return true;
+		if(first)
+			return false;
+	}
+
+	return false;
+}
+
+static void verify(size_t i, int samples, sig_result& r)
+{
+	uint32_t seed, mask, word, state = 0x1337 ^ (uint32_t)(i * 0x9E3779B9);
+	vector<int> efforts;
+	string src, src2, err;
+	uint8_t encoding[4];
+
+	if(!state)
+		state = 1;
+
+	r.sig = signature_get(i, seed, mask);
+	r.n = r.ok = 0;
+
+	for(int j=0; j<samples; ++j) {
+		int failures;
+
+		if(!sample_word(r.sig, seed, mask, j==0, state, word))
+			continue;
+		if(disasm_capstone((uint8_t *)&word, VERIFY_ADDR, src, err))
+			continue;
+		r.n++;
+
+		if(assemble_single(src, VERIFY_ADDR, encoding, err, failures)) {
+			if(r.example.empty())
+				r.example = src + ": " + err;
+			efforts.push_back(failures);
+			continue;
+		}
+		efforts.push_back(failures);
+
+		if(disasm_capstone(encoding, VERIFY_ADDR, src2, err) || src2 != src) {
+			if(r.example.empty())
+				r.example = src + " -> " + src2;
+			continue;
+		}
+		r.ok++;
+	}
+
+	r.median = r.max = 0;
+	if(!efforts.empty()) {
+		sort(efforts.begin(), efforts.end());
+		r.median = efforts[efforts.size() / 2];
+		r.max = efforts.back();
+	}
+}
+
+int main(int ac, char **av)
+{
+	int samples = ac > 1 ? atoi(av[1]) : SAMPLES_DEFAULT;
+	int max_threads = max(1u, thread::hardware_concurrency());
+	int n_threads = ac > 2 ? atoi(av[2]) : max_threads;
+	size_t n = signature_count();
+	vector<sig_result> results(n);
+	atomic<size_t> next(0);
+
+	if(samples < 1 || n_threads < 1) {
+		printf("usage: %s [samples per signature] [threads]\n", av[0]);
+		return -1;
+	}
+	n_threads = min(n_threads, max_threads);
+
+	/* every sample searches */
+	assemble_cache_configure(0);
+
+	auto worker = [&]() {
+		for(size_t i = next++; i < n; i = next++)
+			verify(i, samples, results[i]);
+	};
+
+	vector<thread> pool;
+	for(int i=1; i<n_threads; ++i)
+		pool.emplace_back(worker);
+	worker();
+	for(auto& t : pool)
+		t.join();
+
+	size_t all = 0, some = 0, none = 0, unsampled = 0;
+	uint64_t n_samples = 0, n_ok = 0;
+
+	printf("%-48s %9s %8s %8s\n", "signature", "ok/n", "median", "max");
+	for(auto& r : results) {
+		printf("%-48s %4d/%-4d %8d %8d", r.sig.c_str(), r.ok, r.n, r.median, r.max);
+		if(!r.example.empty())
+			printf("  e.g. %s", r.example.c_str());
+		printf("\n");
+
+		n_samples += r.n;
+		n_ok += r.ok;
+		if(!r.n)
+			unsampled++;
+		else if(r.ok == r.n)
+			all++;
+		else if(r.ok)
+			some++;
+		else
+			none++;
+	}
+
+	printf("\n%zu signatures: %zu round trip, %zu partly, %zu never, %zu without samples\n",
+		n, all, some, none, unsampled);
+	printf("%" PRIu64 "/%" PRIu64 " samples round trip\n", n_ok, n_samples);
+
+	return n_ok == n_samples ? 0 : 1;
+}